@@ -3,17 +3,16 @@
 #include "utils/conversion_trigger.hpp"
 #include "utils/to_short_enum.hpp"
 
-#include <phosphor-logging/log.hpp>
-
 DiscreteThreshold::DiscreteThreshold(
-    boost::asio::io_context& ioc, const std::string& triggerIdIn,
-    Sensors sensorsIn,
+    utils::TimerWheel& timerWheel,
+    const std::string& triggerIdIn, Sensors sensorsIn,
     std::vector<std::unique_ptr<interfaces::TriggerAction>> actionsIn,
     Milliseconds dwellTimeIn, const std::string& thresholdValueIn,
     const std::string& nameIn, const discrete::Severity severityIn,
     std::unique_ptr<interfaces::Clock> clockIn) :
-    ioc(ioc), triggerId(triggerIdIn), actions(std::move(actionsIn)),
-    dwellTime(dwellTimeIn), thresholdValue(thresholdValueIn),
+    timerWheel(timerWheel), triggerId(triggerIdIn),
+    actions(std::move(actionsIn)), dwellTime(dwellTimeIn),
+    thresholdValue(thresholdValueIn),
     numericThresholdValue(utils::stodStrict(thresholdValue)),
     severity(severityIn), name(getNonEmptyName(nameIn)),
     clock(std::move(clockIn))
@@ -43,20 +42,17 @@ DiscreteThreshold::ThresholdDetail& DiscreteThreshold::getDetails(
 std::shared_ptr<DiscreteThreshold::ThresholdDetail>
     DiscreteThreshold::makeDetails(const std::string& sensorName)
 {
-    return std::make_shared<ThresholdDetail>(sensorName, ioc);
+    return std::make_shared<ThresholdDetail>(sensorName, *this, timerWheel);
 }
 
 void DiscreteThreshold::sensorUpdated(interfaces::Sensor& sensor,
                                       Milliseconds timestamp, double value)
 {
     auto& details = getDetails(sensor);
-    auto& dwell = details.dwell;
-    auto& timer = details.timer;
 
-    if (dwell && value != numericThresholdValue)
+    if (details.timer.isPending() && value != numericThresholdValue)
     {
-        timer.cancel();
-        dwell = false;
+        details.timer.cancel();
     }
     else if (value == numericThresholdValue)
     {
@@ -67,29 +63,14 @@ void DiscreteThreshold::sensorUpdated(interfaces::Sensor& sensor,
 void DiscreteThreshold::startTimer(DiscreteThreshold::ThresholdDetail& details,
                                    double value)
 {
-    auto& sensorName = details.getSensorName();
-    auto& dwell = details.dwell;
-    auto& timer = details.timer;
-
     if (dwellTime == Milliseconds::zero())
     {
-        commit(sensorName, value);
+        commit(details.getSensorName(), value);
     }
     else
     {
-        dwell = true;
-        timer.expires_after(dwellTime);
-        timer.async_wait([this, &sensorName, &dwell,
-                          value](const boost::system::error_code ec) {
-            if (ec)
-            {
-                phosphor::logging::log<phosphor::logging::level::DEBUG>(
-                    "Timer has been canceled");
-                return;
-            }
-            commit(sensorName, value);
-            dwell = false;
-        });
+        details.dwellValue = value;
+        details.timer.start(dwellTime);
     }
 }
 
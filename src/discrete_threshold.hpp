@@ -8,8 +8,7 @@
 #include "types/duration_types.hpp"
 #include "types/trigger_types.hpp"
 #include "utils/threshold_operations.hpp"
-
-#include <boost/asio/steady_timer.hpp>
+#include "utils/timer_wheel.hpp"
 
 #include <chrono>
 #include <map>
@@ -23,7 +22,7 @@ class DiscreteThreshold :
 {
   public:
     DiscreteThreshold(
-        boost::asio::io_context& ioc, const std::string& triggerId,
+        utils::TimerWheel& timerWheel, const std::string& triggerId,
         Sensors sensors,
         std::vector<std::unique_ptr<interfaces::TriggerAction>> actions,
         Milliseconds dwellTime, const std::string& thresholdValue,
@@ -41,7 +40,7 @@ class DiscreteThreshold :
     void updateSensors(Sensors newSensors) override;
 
   private:
-    boost::asio::io_context& ioc;
+    utils::TimerWheel& timerWheel;
     const std::string& triggerId;
     const std::vector<std::unique_ptr<interfaces::TriggerAction>> actions;
     const Milliseconds dwellTime;
@@ -54,12 +53,17 @@ class DiscreteThreshold :
 
     struct ThresholdDetail
     {
-        bool dwell = false;
-        boost::asio::steady_timer timer;
+        double dwellValue = 0.0;
+        utils::TimerWheel::Timer timer;
 
         ThresholdDetail(const std::string& sensorNameIn,
-                        boost::asio::io_context& ioc) :
-            timer(ioc), sensorName(sensorNameIn)
+                        DiscreteThreshold& threshold,
+                        utils::TimerWheel& timerWheel) :
+            timer(timerWheel,
+                  [this, &threshold] {
+                      threshold.commit(sensorName, dwellValue);
+                  }),
+            sensorName(sensorNameIn)
         {}
         ~ThresholdDetail() = default;
         ThresholdDetail(const ThresholdDetail&) = delete;
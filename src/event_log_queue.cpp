@@ -0,0 +1,161 @@
+#include "event_log_queue.hpp"
+
+#include <phosphor-logging/log.hpp>
+
+#include <format>
+
+namespace
+{
+constexpr char keySeparator = '\0';
+}
+
+EventLogQueue::EventLogQueue(boost::asio::io_context& ioc, Limits limitsIn,
+                             std::unique_ptr<interfaces::Clock> clockIn) :
+    timer(ioc), limits(limitsIn), clock(std::move(clockIn))
+{
+    events.reserve(limits.capacity);
+    writing.reserve(limits.capacity);
+}
+
+EventLogQueue::~EventLogQueue()
+{
+    flush();
+}
+
+EventLogQueue::Limits EventLogQueue::defaultLimits()
+{
+    return Limits{.capacity = TELEMETRY_MAX_QUEUED_LOG_EVENTS,
+                  .eventsPerWindow = TELEMETRY_MAX_LOG_EVENTS_PER_SENSOR,
+                  .window = Milliseconds(1000),
+                  .flushInterval = Milliseconds(100)};
+}
+
+void EventLogQueue::push(const char* message, const char* redfishMessageId,
+                         const std::string& triggerId,
+                         const std::string& sensorName,
+                         std::string redfishMessageArgs)
+{
+    const Milliseconds now = clock->steadyTimestamp();
+
+    key.assign(triggerId);
+    key.push_back(keySeparator);
+    key.append(sensorName);
+
+    auto it = rates.find(key);
+    if (it == rates.end())
+    {
+        it = rates.emplace(key, RateState{.windowStart = now}).first;
+    }
+
+    auto& state = it->second;
+    if (now - state.windowStart >= limits.window)
+    {
+        summarize(it->first, state);
+        state = RateState{.windowStart = now};
+    }
+
+    if (state.events >= limits.eventsPerWindow)
+    {
+        ++state.suppressed;
+        ++counters.suppressed;
+        scheduleFlush();
+        return;
+    }
+
+    ++state.events;
+    enqueue(Event{message, redfishMessageId, std::move(redfishMessageArgs)});
+}
+
+void EventLogQueue::flush()
+{
+    rollWindows(clock->steadyTimestamp());
+
+    std::swap(events, writing);
+    for (const auto& event : writing)
+    {
+        if (event.redfishMessageId == nullptr)
+        {
+            phosphor::logging::log<phosphor::logging::level::WARNING>(
+                event.message,
+                phosphor::logging::entry("SUPPRESSED_EVENTS=%s",
+                                         event.redfishMessageArgs.c_str()));
+        }
+        else
+        {
+            phosphor::logging::log<phosphor::logging::level::INFO>(
+                event.message,
+                phosphor::logging::entry("REDFISH_MESSAGE_ID=%s",
+                                         event.redfishMessageId),
+                phosphor::logging::entry("REDFISH_MESSAGE_ARGS=%s",
+                                         event.redfishMessageArgs.c_str()));
+        }
+        ++counters.logged;
+    }
+    writing.clear();
+
+    if (!rates.empty())
+    {
+        scheduleFlush();
+    }
+}
+
+void EventLogQueue::enqueue(Event event)
+{
+    if (events.size() >= limits.capacity)
+    {
+        ++counters.dropped;
+        return;
+    }
+
+    events.emplace_back(std::move(event));
+    scheduleFlush();
+}
+
+void EventLogQueue::summarize(const std::string& rateKey, RateState& state)
+{
+    if (state.suppressed == 0)
+    {
+        return;
+    }
+
+    const auto separator = rateKey.find(keySeparator);
+    enqueue(Event{"Trigger action log events suppressed.", nullptr,
+                  std::format("{},{},{}", state.suppressed,
+                              rateKey.substr(separator + 1),
+                              rateKey.substr(0, separator))});
+}
+
+void EventLogQueue::rollWindows(Milliseconds now)
+{
+    for (auto it = rates.begin(); it != rates.end();)
+    {
+        if (now - it->second.windowStart >= limits.window)
+        {
+            summarize(it->first, it->second);
+            it = rates.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void EventLogQueue::scheduleFlush()
+{
+    if (flushScheduled)
+    {
+        return;
+    }
+
+    flushScheduled = true;
+    timer.expires_after(limits.flushInterval);
+    timer.async_wait([this](const boost::system::error_code& ec) {
+        if (ec)
+        {
+            return;
+        }
+        flushScheduled = false;
+        flush();
+    });
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "interfaces/clock.hpp"
+#include "types/duration_types.hpp"
+#include "types/event_log_counters.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Bounded queue of trigger action journal entries flushed periodically.
+ *
+ *  A flush drains the whole queue, but every event is still submitted to
+ *  the journal as its own entry, since REDFISH_MESSAGE_ID and
+ *  REDFISH_MESSAGE_ARGS are per entry fields.
+ *
+ *  Each trigger and sensor pair may log a limited number of events per
+ *  window, further events are counted and reported in a single summary
+ *  entry once the window ends. Events pushed into a full queue are
+ *  dropped. */
+class EventLogQueue
+{
+  public:
+    struct Limits
+    {
+        size_t capacity;
+        size_t eventsPerWindow;
+        Milliseconds window;
+        Milliseconds flushInterval;
+    };
+
+    EventLogQueue(boost::asio::io_context& ioc, Limits limits,
+                  std::unique_ptr<interfaces::Clock> clock);
+    ~EventLogQueue();
+    EventLogQueue(const EventLogQueue&) = delete;
+    EventLogQueue& operator=(const EventLogQueue&) = delete;
+    EventLogQueue(EventLogQueue&&) = delete;
+    EventLogQueue& operator=(EventLogQueue&&) = delete;
+
+    void push(const char* message, const char* redfishMessageId,
+              const std::string& triggerId, const std::string& sensorName,
+              std::string redfishMessageArgs);
+    void flush();
+
+    const EventLogCounters& getCounters() const
+    {
+        return counters;
+    }
+
+    size_t size() const
+    {
+        return events.size();
+    }
+
+    static Limits defaultLimits();
+
+  private:
+    struct Event
+    {
+        const char* message;
+        const char* redfishMessageId;
+        std::string redfishMessageArgs;
+    };
+
+    struct RateState
+    {
+        Milliseconds windowStart;
+        size_t events = 0;
+        uint64_t suppressed = 0;
+    };
+
+    boost::asio::steady_timer timer;
+    const Limits limits;
+    std::unique_ptr<interfaces::Clock> clock;
+    std::vector<Event> events;
+    std::vector<Event> writing;
+    std::map<std::string, RateState, std::less<>> rates;
+    std::string key;
+    EventLogCounters counters;
+    bool flushScheduled = false;
+
+    void enqueue(Event event);
+    void summarize(const std::string& rateKey, RateState& state);
+    void rollWindows(Milliseconds now);
+    void scheduleFlush();
+};
@@ -0,0 +1,241 @@
+#include "history/block.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace history
+{
+
+namespace
+{
+
+constexpr uint32_t blockMagic = 0x42484c54; // "TLHB"
+
+template <class T>
+void putLittleEndian(uint8_t* out, T value)
+{
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+template <class T>
+T getLittleEndian(const uint8_t* in)
+{
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        value |= static_cast<T>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+void putVarint(std::vector<uint8_t>& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+bool getVarint(std::span<const uint8_t> in, size_t& pos, uint64_t& value)
+{
+    value = 0;
+    for (unsigned shift = 0; shift < 64 && pos < in.size(); shift += 7)
+    {
+        const uint8_t byte = in[pos++];
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t zigzag(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^
+           static_cast<uint64_t>(value >> 63);
+}
+
+int64_t unzigzag(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+uint64_t reverseBytes(uint64_t value)
+{
+    uint64_t result = 0;
+    for (size_t i = 0; i < sizeof(value); ++i)
+    {
+        result = (result << 8) | ((value >> (8 * i)) & 0xff);
+    }
+    return result;
+}
+
+uint32_t checksum(std::span<const uint8_t> data)
+{
+    uint32_t hash = 2166136261u;
+    for (uint8_t byte : data)
+    {
+        hash = (hash ^ byte) * 16777619u;
+    }
+    return hash;
+}
+
+} // namespace
+
+void BlockEncoder::add(const std::string& metricId, double value,
+                       uint64_t timestamp)
+{
+    auto [it, inserted] = idIndexes.try_emplace(
+        metricId, static_cast<uint32_t>(idIndexes.size()));
+    if (inserted)
+    {
+        ids.emplace_back(&it->first);
+        previousValues.emplace_back(0);
+    }
+    const uint32_t index = it->second;
+
+    if (header.readingCount == 0)
+    {
+        header.firstTimestamp = timestamp;
+        header.lastTimestamp = timestamp;
+    }
+    header.firstTimestamp = std::min(header.firstTimestamp, timestamp);
+    header.lastTimestamp = std::max(header.lastTimestamp, timestamp);
+    ++header.readingCount;
+
+    const auto bits = std::bit_cast<uint64_t>(value);
+    putVarint(payload, index);
+    putVarint(payload, zigzag(static_cast<int64_t>(timestamp) -
+                              static_cast<int64_t>(previousTimestamp)));
+    putVarint(payload, reverseBytes(bits ^ previousValues[index]));
+
+    previousTimestamp = timestamp;
+    previousValues[index] = bits;
+}
+
+void BlockEncoder::finish(std::vector<uint8_t>& out)
+{
+    const auto idsOffset = static_cast<uint32_t>(payload.size());
+    putVarint(payload, ids.size());
+    for (const auto* metricId : ids)
+    {
+        putVarint(payload, metricId->size());
+        payload.insert(payload.end(), metricId->begin(), metricId->end());
+    }
+
+    const size_t begin = out.size();
+    out.resize(begin + headerSize);
+    uint8_t* h = out.data() + begin;
+    putLittleEndian(h, blockMagic);
+    putLittleEndian(h + 4, static_cast<uint32_t>(payload.size()));
+    putLittleEndian(h + 8, header.firstTimestamp);
+    putLittleEndian(h + 16, header.lastTimestamp);
+    putLittleEndian(h + 24, header.readingCount);
+    putLittleEndian(h + 28, idsOffset);
+    putLittleEndian(h + 32, checksum(payload));
+    putLittleEndian(h + 36, uint32_t{0});
+    out.insert(out.end(), payload.begin(), payload.end());
+
+    header = BlockHeader{};
+    payload.clear();
+    idIndexes.clear();
+    ids.clear();
+    previousValues.clear();
+    previousTimestamp = 0;
+}
+
+bool BlockCursor::next()
+{
+    constexpr size_t headerSize = BlockEncoder::headerSize;
+
+    if (data.size() - pos < headerSize)
+    {
+        return false;
+    }
+
+    const uint8_t* h = data.data() + pos;
+    const auto payloadSize = getLittleEndian<uint32_t>(h + 4);
+    const auto idsOffset = getLittleEndian<uint32_t>(h + 28);
+    if (getLittleEndian<uint32_t>(h) != blockMagic ||
+        data.size() - pos - headerSize < payloadSize || idsOffset > payloadSize)
+    {
+        return false;
+    }
+
+    const auto payload = data.subspan(pos + headerSize, payloadSize);
+    if (checksum(payload) != getLittleEndian<uint32_t>(h + 32))
+    {
+        return false;
+    }
+
+    current.firstTimestamp = getLittleEndian<uint64_t>(h + 8);
+    current.lastTimestamp = getLittleEndian<uint64_t>(h + 16);
+    current.readingCount = getLittleEndian<uint32_t>(h + 24);
+    readings = payload.first(idsOffset);
+    idTable = payload.subspan(idsOffset);
+    pos += headerSize + payloadSize;
+    return true;
+}
+
+void BlockCursor::decode(std::vector<ReadingData>& out, uint64_t start,
+                         uint64_t end) const
+{
+    if (current.lastTimestamp < start || current.firstTimestamp > end)
+    {
+        return;
+    }
+
+    std::vector<std::string> ids;
+    size_t idPos = 0;
+    uint64_t idCount = 0;
+    if (!getVarint(idTable, idPos, idCount) || idCount > idTable.size())
+    {
+        return;
+    }
+    ids.reserve(idCount);
+    for (uint64_t i = 0; i < idCount; ++i)
+    {
+        uint64_t size = 0;
+        if (!getVarint(idTable, idPos, size) || idTable.size() - idPos < size)
+        {
+            return;
+        }
+        ids.emplace_back(reinterpret_cast<const char*>(&idTable[idPos]), size);
+        idPos += size;
+    }
+
+    std::vector<uint64_t> previousValues(ids.size(), 0);
+    uint64_t timestamp = 0;
+    size_t readingPos = 0;
+    for (uint32_t i = 0; i < current.readingCount; ++i)
+    {
+        uint64_t index = 0;
+        uint64_t delta = 0;
+        uint64_t xorBits = 0;
+        if (!getVarint(readings, readingPos, index) ||
+            !getVarint(readings, readingPos, delta) ||
+            !getVarint(readings, readingPos, xorBits) || index >= ids.size())
+        {
+            return;
+        }
+
+        timestamp += static_cast<uint64_t>(unzigzag(delta));
+        previousValues[index] ^= reverseBytes(xorBits);
+
+        if (timestamp >= start && timestamp <= end)
+        {
+            out.emplace_back(ids[index],
+                             std::bit_cast<double>(previousValues[index]),
+                             timestamp);
+        }
+    }
+}
+
+} // namespace history
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "types/readings.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace history
+{
+
+struct BlockHeader
+{
+    uint64_t firstTimestamp = 0;
+    uint64_t lastTimestamp = 0;
+    uint32_t readingCount = 0;
+};
+
+/** Builds a self contained compressed block of readings.
+ *
+ *  A block starts with a fixed size header holding its time range, payload
+ *  size and checksum. The payload stores for every reading a varint metric
+ *  id index, a zigzag varint timestamp delta and a varint of the byte
+ *  reversed XOR with the previous value of the same metric, followed by
+ *  the metric ids table. Unchanged values take a single byte. */
+class BlockEncoder
+{
+  public:
+    static constexpr size_t headerSize = 40;
+
+    void add(const std::string& metricId, double value, uint64_t timestamp);
+
+    bool empty() const
+    {
+        return header.readingCount == 0;
+    }
+
+    /** Appends the finished block to out and starts a new one */
+    void finish(std::vector<uint8_t>& out);
+
+  private:
+    BlockHeader header;
+    std::vector<uint8_t> payload;
+    std::unordered_map<std::string, uint32_t> idIndexes;
+    std::vector<const std::string*> ids;
+    std::vector<uint64_t> previousValues;
+    uint64_t previousTimestamp = 0;
+};
+
+/** Walks blocks stored back to back, stops at the first incomplete or
+ *  corrupted block */
+class BlockCursor
+{
+  public:
+    explicit BlockCursor(std::span<const uint8_t> data) : data(data) {}
+
+    bool next();
+
+    const BlockHeader& header() const
+    {
+        return current;
+    }
+
+    /** Offset just past the last valid block */
+    size_t offset() const
+    {
+        return pos;
+    }
+
+    /** Appends readings of the current block with timestamps within
+     *  [start, end] */
+    void decode(std::vector<ReadingData>& out, uint64_t start,
+                uint64_t end) const;
+
+  private:
+    std::span<const uint8_t> data;
+    size_t pos = 0;
+    BlockHeader current;
+    std::span<const uint8_t> readings;
+    std::span<const uint8_t> idTable;
+};
+
+} // namespace history
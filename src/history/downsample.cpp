@@ -0,0 +1,102 @@
+#include "history/downsample.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+namespace history
+{
+
+Downsampler::Downsampler(size_t maxPoints) : maxPoints(maxPoints) {}
+
+void Downsampler::add(std::string_view metricId, double value,
+                      uint64_t timestamp)
+{
+    auto it = series.find(metricId);
+    if (it == series.end())
+    {
+        it = series.emplace(std::string(metricId), Series{}).first;
+    }
+    auto& points = it->second;
+
+    if (!points.buckets.empty() &&
+        points.buckets.back().count < points.bucketSize)
+    {
+        auto& bucket = points.buckets.back();
+        bucket.sum += value;
+        ++bucket.count;
+        bucket.timestamp = timestamp;
+        return;
+    }
+
+    points.buckets.emplace_back(value, 1, timestamp);
+    ++bucketCount;
+
+    while (bucketCount > maxPoints)
+    {
+        auto largest = std::ranges::max_element(
+            series, {}, [](const auto& item) {
+                return item.second.buckets.size();
+            });
+        if (largest->second.buckets.size() < 2)
+        {
+            break;
+        }
+        halve(largest->second);
+    }
+}
+
+std::vector<ReadingData> Downsampler::finish()
+{
+    std::vector<ReadingData> result;
+    result.reserve(std::min(bucketCount, maxPoints));
+
+    size_t kept = 0;
+    for (const auto& [metricId, points] : series)
+    {
+        if (kept + points.buckets.size() > maxPoints)
+        {
+            break;
+        }
+        kept += points.buckets.size();
+
+        for (const auto& bucket : points.buckets)
+        {
+            result.emplace_back(metricId,
+                                bucket.sum / static_cast<double>(bucket.count),
+                                bucket.timestamp);
+        }
+    }
+
+    series.clear();
+    bucketCount = 0;
+
+    std::ranges::sort(result, [](const ReadingData& lhs,
+                                 const ReadingData& rhs) {
+        return std::tie(std::get<2>(lhs), std::get<0>(lhs)) <
+               std::tie(std::get<2>(rhs), std::get<0>(rhs));
+    });
+    return result;
+}
+
+void Downsampler::halve(Series& points)
+{
+    auto& buckets = points.buckets;
+    size_t merged = 0;
+    for (size_t i = 0; i < buckets.size(); i += 2, ++merged)
+    {
+        auto bucket = buckets[i];
+        if (i + 1 < buckets.size())
+        {
+            bucket.sum += buckets[i + 1].sum;
+            bucket.count += buckets[i + 1].count;
+            bucket.timestamp = buckets[i + 1].timestamp;
+        }
+        buckets[merged] = bucket;
+    }
+
+    bucketCount -= buckets.size() - merged;
+    buckets.resize(merged);
+    points.bucketSize *= 2;
+}
+
+} // namespace history
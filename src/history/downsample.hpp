@@ -0,0 +1,55 @@
+#pragma once
+
+#include "types/readings.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace history
+{
+
+/** Reduces a stream of readings to at most maxPoints readings.
+ *
+ *  Readings of a metric have to be added in timestamp order. Consecutive
+ *  readings of a metric are grouped into buckets, whenever there are more
+ *  buckets than maxPoints the buckets of the metric holding the most of them
+ *  are merged in pairs, so memory stays bounded by maxPoints and the number
+ *  of metrics. Readings within the limit are returned unchanged. Every
+ *  bucket is replaced by the mean of its values stamped with its last
+ *  timestamp. When there are more metrics than maxPoints, only the first
+ *  maxPoints metric ids are kept. The result is ordered by timestamp and
+ *  metric id. */
+class Downsampler
+{
+  public:
+    explicit Downsampler(size_t maxPoints);
+
+    void add(std::string_view metricId, double value, uint64_t timestamp);
+    std::vector<ReadingData> finish();
+
+  private:
+    struct Bucket
+    {
+        double sum;
+        size_t count;
+        uint64_t timestamp;
+    };
+
+    struct Series
+    {
+        std::vector<Bucket> buckets;
+        size_t bucketSize = 1;
+    };
+
+    size_t maxPoints;
+    size_t bucketCount = 0;
+    std::map<std::string, Series, std::less<>> series;
+
+    void halve(Series&);
+};
+
+} // namespace history
@@ -0,0 +1,99 @@
+#include "history/rollup.hpp"
+
+#include <algorithm>
+
+namespace history
+{
+
+Rollup::Rollup(std::vector<Tier> tiersIn) :
+    average(metrics::makeCollectionFunction(OperationType::avg))
+{
+    tiers.reserve(tiersIn.size());
+    for (const auto& tier : tiersIn)
+    {
+        tiers.emplace_back(TierSeries{.tier = tier});
+    }
+}
+
+void Rollup::add(const std::string& metricId, double value, uint64_t timestamp)
+{
+    for (auto& [tier, allSeries] : tiers)
+    {
+        const auto resolution = tier.resolution.count();
+        const uint64_t bucketStart = timestamp - timestamp % resolution;
+
+        auto [it, inserted] = allSeries.try_emplace(metricId);
+        auto& series = it->second;
+        if (bucketStart > series.bucketStart && !inserted)
+        {
+            close(tier, series);
+            series.bucketStart = bucketStart;
+        }
+        else if (bucketStart != series.bucketStart ||
+                 Milliseconds(timestamp) < series.stats.lastTimestamp)
+        {
+            // New series or the system clock moved back, the open bucket
+            // can't be completed consistently so it starts over
+            series.stats.reset();
+            series.bucketStart = bucketStart;
+        }
+
+        series.stats.addReading(Milliseconds(timestamp), value);
+    }
+}
+
+void Rollup::close(const Tier& tier, Series& series) const
+{
+    const auto& stats = series.stats;
+    if (stats.count > 0)
+    {
+        const Milliseconds bucketEnd(series.bucketStart +
+                                     tier.resolution.count());
+        series.points.emplace_back(series.bucketStart, stats.getMin(),
+                                   average->calculate(stats, bucketEnd),
+                                   stats.getMax());
+    }
+    series.stats.reset();
+
+    while (!series.points.empty() &&
+           series.points.front().timestamp + tier.retention.count() <=
+               series.bucketStart)
+    {
+        series.points.pop_front();
+    }
+}
+
+std::optional<std::vector<RollupReading>>
+    Rollup::read(Milliseconds resolution, uint64_t start, uint64_t end) const
+{
+    for (const auto& [tier, allSeries] : tiers)
+    {
+        if (tier.resolution != resolution)
+        {
+            continue;
+        }
+
+        std::vector<RollupReading> result;
+        for (const auto& [metricId, series] : allSeries)
+        {
+            for (const auto& point : series.points)
+            {
+                if (point.timestamp >= start && point.timestamp <= end)
+                {
+                    result.emplace_back(metricId, point.timestamp, point.min,
+                                        point.avg, point.max);
+                }
+            }
+        }
+
+        std::ranges::sort(result, [](const RollupReading& lhs,
+                                     const RollupReading& rhs) {
+            return std::tie(std::get<1>(lhs), std::get<0>(lhs)) <
+                   std::tie(std::get<1>(rhs), std::get<0>(rhs));
+        });
+        return result;
+    }
+    return std::nullopt;
+}
+
+} // namespace history
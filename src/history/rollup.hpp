@@ -0,0 +1,74 @@
+#pragma once
+
+#include "metrics/collection_function.hpp"
+#include "types/duration_types.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace history
+{
+
+/** Metric id, bucket start timestamp, min, time weighted average and max */
+using RollupReading = std::tuple<std::string, uint64_t, double, double, double>;
+
+/** Downsampled tiers of report readings for long retention.
+ *
+ *  Every tier splits time into buckets of its resolution and keeps per
+ *  metric min, average and max of each bucket. Buckets are computed
+ *  incrementally with StreamingStats as readings arrive and closed when the
+ *  first reading of a later bucket shows up. Each tier drops buckets older
+ *  than its own retention. */
+class Rollup
+{
+  public:
+    struct Tier
+    {
+        Milliseconds resolution;
+        Milliseconds retention;
+    };
+
+    explicit Rollup(std::vector<Tier> tiers);
+
+    void add(const std::string& metricId, double value, uint64_t timestamp);
+
+    /** Returns closed buckets of the tier with given resolution starting
+     *  within [start, end], nullopt when there is no such tier */
+    std::optional<std::vector<RollupReading>>
+        read(Milliseconds resolution, uint64_t start, uint64_t end) const;
+
+  private:
+    struct Point
+    {
+        uint64_t timestamp;
+        double min;
+        double avg;
+        double max;
+    };
+
+    struct Series
+    {
+        uint64_t bucketStart = 0;
+        metrics::StreamingStats stats;
+        std::deque<Point> points;
+    };
+
+    struct TierSeries
+    {
+        Tier tier;
+        std::unordered_map<std::string, Series> series = {};
+    };
+
+    void close(const Tier& tier, Series& series) const;
+
+    std::vector<TierSeries> tiers;
+    std::shared_ptr<metrics::CollectionFunction> average;
+};
+
+} // namespace history
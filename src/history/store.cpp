@@ -0,0 +1,355 @@
+#include "history/store.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <phosphor-logging/log.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+
+namespace history
+{
+
+namespace
+{
+
+constexpr std::string_view segmentExtension = ".seg";
+constexpr size_t segmentNameDigits = 16;
+
+/** Read only mapping of a whole segment file */
+class MappedSegment
+{
+  public:
+    explicit MappedSegment(const std::filesystem::path& path)
+    {
+        utils::FileDescriptor fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+        struct stat st = {};
+        if (fd.get() < 0 || ::fstat(fd.get(), &st) != 0 || st.st_size <= 0)
+        {
+            return;
+        }
+
+        void* address = ::mmap(nullptr, static_cast<size_t>(st.st_size),
+                               PROT_READ, MAP_PRIVATE, fd.get(), 0);
+        if (address != MAP_FAILED)
+        {
+            mapping = static_cast<const uint8_t*>(address);
+            size = static_cast<size_t>(st.st_size);
+        }
+    }
+
+    ~MappedSegment()
+    {
+        if (mapping)
+        {
+            ::munmap(const_cast<uint8_t*>(mapping), size);
+        }
+    }
+
+    MappedSegment(const MappedSegment&) = delete;
+    MappedSegment& operator=(const MappedSegment&) = delete;
+
+    std::span<const uint8_t> data() const
+    {
+        return {mapping, size};
+    }
+
+  private:
+    const uint8_t* mapping = nullptr;
+    size_t size = 0;
+};
+
+std::string segmentName(uint64_t sequence)
+{
+    std::string name = std::to_string(sequence);
+    if (name.size() < segmentNameDigits)
+    {
+        name.insert(0, segmentNameDigits - name.size(), '0');
+    }
+    return name.append(segmentExtension);
+}
+
+void logErrno(const char* what, const std::filesystem::path& path)
+{
+    phosphor::logging::log<phosphor::logging::level::ERR>(
+        what, phosphor::logging::entry("PATH=%s", path.c_str()),
+        phosphor::logging::entry("ERROR=%s", std::strerror(errno)));
+}
+
+} // namespace
+
+Store::Store(std::filesystem::path directoryIn, Limits limitsIn) :
+    directory(std::move(directoryIn)), limits(limitsIn)
+{
+    std::filesystem::create_directories(directory);
+    scan();
+    enforceRetention();
+}
+
+Store::~Store()
+{
+    if (!removed)
+    {
+        flush();
+    }
+}
+
+void Store::append(const std::string& metricId, double value,
+                   uint64_t timestamp)
+{
+    if (!removed)
+    {
+        pending.emplace_back(metricId, value, timestamp);
+    }
+}
+
+void Store::tick()
+{
+    if (++ticks >= limits.flushTicks)
+    {
+        flush();
+    }
+}
+
+void Store::flush()
+{
+    ticks = 0;
+    if (pending.empty())
+    {
+        return;
+    }
+
+    uint64_t firstTimestamp = std::get<2>(pending.front());
+    uint64_t lastTimestamp = firstTimestamp;
+    for (const auto& [metricId, value, timestamp] : pending)
+    {
+        encoder.add(metricId, value, timestamp);
+        firstTimestamp = std::min(firstTimestamp, timestamp);
+        lastTimestamp = std::max(lastTimestamp, timestamp);
+    }
+    pending.clear();
+
+    block.clear();
+    encoder.finish(block);
+    write(firstTimestamp, lastTimestamp);
+    enforceRetention();
+}
+
+void Store::remove()
+{
+    removed = true;
+    segmentFd.reset();
+    segments.clear();
+    pending.clear();
+
+    std::error_code ec;
+    std::filesystem::remove_all(directory, ec);
+}
+
+void Store::read(uint64_t start, uint64_t end, const Consumer& consume) const
+{
+    for (const auto& segment : segments)
+    {
+        if (!segment.empty && segment.lastTimestamp >= start &&
+            segment.firstTimestamp <= end)
+        {
+            readSegment(segment, start, end, consume);
+        }
+    }
+
+    std::vector<ReadingData> unflushed;
+    for (const auto& reading : pending)
+    {
+        const auto timestamp = std::get<2>(reading);
+        if (timestamp >= start && timestamp <= end)
+        {
+            unflushed.emplace_back(reading);
+        }
+    }
+    if (!unflushed.empty())
+    {
+        consume(unflushed);
+    }
+}
+
+uint64_t Store::diskUsage() const
+{
+    uint64_t total = 0;
+    for (const auto& segment : segments)
+    {
+        total += segment.size;
+    }
+    return total;
+}
+
+void Store::scan()
+{
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        const auto& path = entry.path();
+        const auto stem = path.stem().string();
+        uint64_t sequence = 0;
+        auto [end, ec] = std::from_chars(stem.data(),
+                                         stem.data() + stem.size(), sequence);
+        if (path.extension() != segmentExtension || ec != std::errc{} ||
+            end != stem.data() + stem.size())
+        {
+            continue;
+        }
+
+        Segment segment{.path = path};
+        MappedSegment mapped(path);
+        BlockCursor cursor(mapped.data());
+        for (size_t offset = 0; cursor.next(); offset = cursor.offset())
+        {
+            const auto& header = cursor.header();
+            segment.blocks.emplace_back(offset, header.firstTimestamp,
+                                        header.lastTimestamp);
+            segment.firstTimestamp = segment.empty
+                                         ? header.firstTimestamp
+                                         : std::min(segment.firstTimestamp,
+                                                    header.firstTimestamp);
+            segment.lastTimestamp =
+                std::max(segment.lastTimestamp, header.lastTimestamp);
+            segment.empty = false;
+        }
+        segment.size = mapped.data().size();
+
+        if (segment.empty)
+        {
+            std::error_code removeEc;
+            std::filesystem::remove(path, removeEc);
+            continue;
+        }
+
+        nextSequence = std::max(nextSequence, sequence + 1);
+        segments.emplace_back(std::move(segment));
+    }
+
+    std::ranges::sort(segments, {}, [](const Segment& segment) {
+        return segment.path.filename();
+    });
+}
+
+void Store::openSegment()
+{
+    auto path = directory / segmentName(nextSequence++);
+    segmentFd = utils::FileDescriptor(
+        ::open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_APPEND | O_CLOEXEC,
+               S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH));
+    if (segmentFd.get() < 0)
+    {
+        logErrno("Failed to create history segment", path);
+        return;
+    }
+    segments.emplace_back(Segment{.path = std::move(path)});
+}
+
+void Store::write(uint64_t firstTimestamp, uint64_t lastTimestamp)
+{
+    if (segmentFd.get() < 0)
+    {
+        openSegment();
+        if (segmentFd.get() < 0)
+        {
+            return;
+        }
+    }
+
+    auto& segment = segments.back();
+    const size_t offset = segment.size;
+    size_t written = 0;
+    while (written < block.size())
+    {
+        const auto result = ::write(segmentFd.get(), block.data() + written,
+                                    block.size() - written);
+        if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (result <= 0)
+        {
+            // Blocks following a torn one would be unreachable, so the next
+            // flush starts a new segment
+            logErrno("Failed to write history segment", segment.path);
+            segment.size += written;
+            segmentFd.reset();
+            return;
+        }
+        written += static_cast<size_t>(result);
+    }
+
+    segment.size += written;
+    segment.blocks.emplace_back(offset, firstTimestamp, lastTimestamp);
+    segment.firstTimestamp = segment.empty ? firstTimestamp
+                                           : std::min(segment.firstTimestamp,
+                                                      firstTimestamp);
+    segment.lastTimestamp = std::max(segment.lastTimestamp, lastTimestamp);
+    segment.empty = false;
+
+    if (segment.size >= limits.segmentSize)
+    {
+        segmentFd.reset();
+    }
+}
+
+void Store::enforceRetention()
+{
+    uint64_t total = diskUsage();
+    uint64_t newest = 0;
+    for (const auto& segment : segments)
+    {
+        newest = std::max(newest, segment.lastTimestamp);
+    }
+
+    while (segments.size() > 1)
+    {
+        const auto& oldest = segments.front();
+        const bool tooOld = oldest.lastTimestamp +
+                                static_cast<uint64_t>(limits.maxAge.count()) <
+                            newest;
+        if (total <= limits.maxSize && !tooOld)
+        {
+            break;
+        }
+
+        std::error_code ec;
+        std::filesystem::remove(oldest.path, ec);
+        total -= oldest.size;
+        segments.pop_front();
+    }
+}
+
+void Store::readSegment(const Segment& segment, uint64_t start, uint64_t end,
+                        const Consumer& consume)
+{
+    MappedSegment mapped(segment.path);
+    const auto data = mapped.data();
+    std::vector<ReadingData> decoded;
+    for (const auto& block : segment.blocks)
+    {
+        if (block.lastTimestamp < start || block.firstTimestamp > end ||
+            block.offset >= data.size())
+        {
+            continue;
+        }
+
+        BlockCursor cursor(data.subspan(block.offset));
+        if (cursor.next())
+        {
+            decoded.clear();
+            cursor.decode(decoded, start, end);
+            if (!decoded.empty())
+            {
+                consume(decoded);
+            }
+        }
+    }
+}
+
+} // namespace history
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "history/block.hpp"
+#include "types/duration_types.hpp"
+#include "types/readings.hpp"
+#include "utils/file_descriptor.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace history
+{
+
+/** Append only, segmented on disk log of report readings.
+ *
+ *  Readings are buffered and encoded into a compressed block which is
+ *  written to the newest segment file every flushTicks ticks, so flash sees
+ *  one write per batch. Segments are rotated once they reach segmentSize and
+ *  the oldest ones are deleted to keep the store within maxSize and to drop
+ *  data older than maxAge relative to the newest reading. A torn block left
+ *  by a power loss fails its checksum and is skipped by readers. */
+class Store
+{
+  public:
+    struct Limits
+    {
+        uint64_t maxSize;
+        Milliseconds maxAge;
+        uint64_t segmentSize;
+        uint64_t flushTicks;
+    };
+
+    Store(std::filesystem::path directory, Limits limits);
+    ~Store();
+
+    Store(const Store&) = delete;
+    Store& operator=(const Store&) = delete;
+
+    void append(const std::string& metricId, double value, uint64_t timestamp);
+
+    /** Called once per report update, flushes every flushTicks calls */
+    void tick();
+    void flush();
+
+    /** Deletes all stored data, nothing is written afterwards */
+    void remove();
+
+    using Consumer = std::function<void(std::span<const ReadingData>)>;
+
+    /** Passes readings with timestamps within [start, end] to consume one
+     *  block at a time, the ones not flushed yet come last */
+    void read(uint64_t start, uint64_t end, const Consumer& consume) const;
+
+    uint64_t diskUsage() const;
+
+  private:
+    /** Time range of a block, lets reads decode only the blocks they need */
+    struct BlockIndex
+    {
+        size_t offset;
+        uint64_t firstTimestamp;
+        uint64_t lastTimestamp;
+    };
+
+    struct Segment
+    {
+        std::filesystem::path path;
+        std::vector<BlockIndex> blocks = {};
+        uint64_t size = 0;
+        uint64_t firstTimestamp = 0;
+        uint64_t lastTimestamp = 0;
+        bool empty = true;
+    };
+
+    void scan();
+    void openSegment();
+    void write(uint64_t firstTimestamp, uint64_t lastTimestamp);
+    void enforceRetention();
+    static void readSegment(const Segment& segment, uint64_t start,
+                            uint64_t end, const Consumer& consume);
+
+    std::filesystem::path directory;
+    Limits limits;
+    std::deque<Segment> segments;
+    uint64_t nextSequence = 0;
+    utils::FileDescriptor segmentFd;
+    BlockEncoder encoder;
+    std::vector<ReadingData> pending;
+    std::vector<uint8_t> block;
+    uint64_t ticks = 0;
+    bool removed = false;
+};
+
+} // namespace history
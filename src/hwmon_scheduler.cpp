@@ -0,0 +1,167 @@
+#include "hwmon_scheduler.hpp"
+
+#include "hwmon_sensor.hpp"
+#include "utils/clock.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <phosphor-logging/log.hpp>
+
+#include <array>
+#include <charconv>
+#include <utility>
+
+HwmonScheduler::HwmonScheduler(boost::asio::io_context& ioc,
+                               Milliseconds interval,
+                               std::filesystem::path sysfsRoot) :
+    timer(ioc), interval(interval), sysfsRoot(std::move(sysfsRoot))
+{}
+
+bool HwmonScheduler::isHwmonPath(std::string_view path)
+{
+    return path.starts_with(pathPrefix);
+}
+
+double HwmonScheduler::scaleFor(std::string_view path)
+{
+    auto name = path.substr(path.rfind('/') + 1);
+    auto type = name.substr(0, name.find_first_of("0123456789"));
+
+    if (type == "power" || type == "energy")
+    {
+        return 1e-6;
+    }
+    if (type == "temp" || type == "in" || type == "curr" ||
+        type == "humidity")
+    {
+        return 1e-3;
+    }
+    return 1.0;
+}
+
+bool HwmonScheduler::isReadable(std::string_view path) const
+{
+    return isHwmonPath(path) && path.ends_with("_input") &&
+           ::access(toSysfsPath(path).c_str(), R_OK) == 0;
+}
+
+void HwmonScheduler::add(const std::shared_ptr<HwmonSensor>& sensor)
+{
+    const auto& path = sensor->id().path();
+
+    auto& entry = entries.emplace_back(Entry{
+        .key = sensor.get(),
+        .sensor = sensor,
+        .fd = utils::FileDescriptor(
+            ::open(toSysfsPath(path).c_str(), O_RDONLY | O_CLOEXEC)),
+        .scale = scaleFor(path)});
+
+    read(entry, Clock().steadyTimestamp());
+    schedule();
+}
+
+void HwmonScheduler::remove(const HwmonSensor& sensor)
+{
+    // Entries are only marked here and dropped on the next poll, as this is
+    // reachable from listeners notified while entries are iterated.
+    for (auto& entry : entries)
+    {
+        if (entry.key == &sensor)
+        {
+            entry.key = nullptr;
+            entry.sensor.reset();
+        }
+    }
+}
+
+void HwmonScheduler::poll()
+{
+    std::erase_if(entries,
+                  [](const auto& entry) { return entry.sensor.expired(); });
+
+    const auto timestamp = Clock().steadyTimestamp();
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        read(entries[i], timestamp);
+    }
+}
+
+std::filesystem::path
+    HwmonScheduler::toSysfsPath(std::string_view path) const
+{
+    return sysfsRoot / std::filesystem::path(path).relative_path();
+}
+
+void HwmonScheduler::read(Entry& entry, Milliseconds timestamp)
+{
+    auto sensor = entry.sensor.lock();
+    if (!sensor)
+    {
+        return;
+    }
+
+    if (entry.fd.get() < 0)
+    {
+        entry.fd = utils::FileDescriptor(::open(
+            toSysfsPath(sensor->id().path()).c_str(), O_RDONLY | O_CLOEXEC));
+    }
+
+    std::array<char, 32> buffer;
+    int64_t raw = 0;
+    bool valid = false;
+
+    if (entry.fd.get() >= 0)
+    {
+        const auto size =
+            ::pread(entry.fd.get(), buffer.data(), buffer.size(), 0);
+        valid = size > 0 && std::from_chars(buffer.data(),
+                                            buffer.data() + size, raw)
+                                    .ec == std::errc();
+    }
+
+    if (!valid)
+    {
+        if (!entry.failed)
+        {
+            phosphor::logging::log<phosphor::logging::level::WARNING>(
+                "Failed to read hwmon attribute",
+                phosphor::logging::entry("SENSOR_PATH=%s",
+                                         sensor->id().path().c_str()));
+        }
+        entry.failed = true;
+        entry.fd.reset();
+        return;
+    }
+
+    entry.failed = false;
+
+    // Listeners may add or remove entries, so the entry is not touched after
+    // the sensor is notified.
+    sensor->updateValue(static_cast<double>(raw) * entry.scale, timestamp);
+}
+
+void HwmonScheduler::schedule()
+{
+    if (scheduled)
+    {
+        return;
+    }
+
+    scheduled = true;
+    timer.expires_after(interval);
+    timer.async_wait([this](boost::system::error_code ec) {
+        if (ec)
+        {
+            return;
+        }
+
+        scheduled = false;
+        poll();
+
+        if (!entries.empty())
+        {
+            schedule();
+        }
+    });
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "types/duration_types.hpp"
+#include "utils/file_descriptor.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+class HwmonSensor;
+
+/** Samples hwmon *_input attributes straight from sysfs.
+ *
+ * All scheduled sensors are read on one shared timer. Attribute files are
+ * opened once and re-read with pread, the raw value is scaled to the units
+ * used by xyz.openbmc_project.Sensor.Value.
+ */
+class HwmonScheduler
+{
+  public:
+    static constexpr std::string_view service = "hwmon";
+    static constexpr std::string_view pathPrefix = "/sys/class/hwmon/";
+
+    HwmonScheduler(boost::asio::io_context& ioc, Milliseconds interval,
+                   std::filesystem::path sysfsRoot = "/");
+
+    HwmonScheduler(const HwmonScheduler&) = delete;
+    HwmonScheduler& operator=(const HwmonScheduler&) = delete;
+
+    static bool isHwmonPath(std::string_view path);
+    static double scaleFor(std::string_view path);
+
+    bool isReadable(std::string_view path) const;
+
+    void add(const std::shared_ptr<HwmonSensor>& sensor);
+    void remove(const HwmonSensor& sensor);
+    void poll();
+
+  private:
+    struct Entry
+    {
+        const HwmonSensor* key;
+        std::weak_ptr<HwmonSensor> sensor;
+        utils::FileDescriptor fd;
+        double scale;
+        bool failed = false;
+    };
+
+    std::filesystem::path toSysfsPath(std::string_view path) const;
+    void read(Entry& entry, Milliseconds timestamp);
+    void schedule();
+
+    boost::asio::steady_timer timer;
+    Milliseconds interval;
+    std::filesystem::path sysfsRoot;
+    std::vector<Entry> entries;
+    bool scheduled = false;
+};
@@ -0,0 +1,113 @@
+#include "hwmon_sensor.hpp"
+
+#include "hwmon_scheduler.hpp"
+
+#include <algorithm>
+
+HwmonSensor::HwmonSensor(interfaces::Sensor::Id sensorId,
+                         const std::string& sensorMetadata,
+                         HwmonScheduler& scheduler) :
+    sensorId(std::move(sensorId)), sensorMetadata(sensorMetadata),
+    scheduler(scheduler)
+{}
+
+HwmonSensor::~HwmonSensor()
+{
+    if (scheduled)
+    {
+        scheduler.remove(*this);
+    }
+}
+
+HwmonSensor::Id HwmonSensor::makeId(std::string_view service,
+                                    std::string_view path)
+{
+    return Id("HwmonSensor", service, path);
+}
+
+HwmonSensor::Id HwmonSensor::id() const
+{
+    return sensorId;
+}
+
+std::string HwmonSensor::metadata() const
+{
+    return sensorMetadata;
+}
+
+std::string HwmonSensor::getName() const
+{
+    return sensorMetadata.empty() ? sensorId.path() : sensorMetadata;
+}
+
+void HwmonSensor::registerForUpdates(
+    const std::weak_ptr<interfaces::SensorListener>& weakListener)
+{
+    listeners.erase(
+        std::remove_if(listeners.begin(), listeners.end(),
+                       [](const auto& listener) { return listener.expired(); }),
+        listeners.end());
+
+    if (auto listener = weakListener.lock())
+    {
+        listeners.emplace_back(weakListener);
+
+        if (value)
+        {
+            listener->sensorUpdated(*this, timestamp, *value);
+        }
+
+        if (!scheduled)
+        {
+            scheduled = true;
+            scheduler.add(shared_from_this());
+        }
+    }
+}
+
+void HwmonSensor::unregisterFromUpdates(
+    const std::weak_ptr<interfaces::SensorListener>& weakListener)
+{
+    if (auto listener = weakListener.lock())
+    {
+        listeners.erase(
+            std::remove_if(
+                listeners.begin(), listeners.end(),
+                [listenerToUnregister = listener.get()](const auto& listener) {
+                    return (listener.expired() ||
+                            listener.lock().get() == listenerToUnregister);
+                }),
+            listeners.end());
+    }
+
+    if (listeners.empty() && scheduled)
+    {
+        scheduled = false;
+        value = std::nullopt;
+        scheduler.remove(*this);
+    }
+}
+
+void HwmonSensor::updateValue(double newValue, Milliseconds newTimestamp)
+{
+    timestamp = newTimestamp;
+
+    if (value != newValue)
+    {
+        value = newValue;
+
+        for (const auto& weakListener : listeners)
+        {
+            if (auto listener = weakListener.lock())
+            {
+                listener->sensorUpdated(*this, timestamp, *value);
+            }
+        }
+    }
+}
+
+LabeledSensorInfo HwmonSensor::getLabeledSensorInfo() const
+{
+    return LabeledSensorInfo(sensorId.service(), sensorId.path(),
+                             sensorMetadata);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "interfaces/sensor.hpp"
+#include "interfaces/sensor_listener.hpp"
+#include "types/duration_types.hpp"
+
+#include <memory>
+#include <optional>
+
+class HwmonScheduler;
+
+class HwmonSensor final :
+    public interfaces::Sensor,
+    public std::enable_shared_from_this<HwmonSensor>
+{
+  public:
+    HwmonSensor(interfaces::Sensor::Id sensorId,
+                const std::string& sensorMetadata, HwmonScheduler& scheduler);
+
+    ~HwmonSensor();
+    HwmonSensor(const HwmonSensor&) = delete;
+    HwmonSensor& operator=(const HwmonSensor&) = delete;
+    HwmonSensor(HwmonSensor&&) = delete;
+    HwmonSensor& operator=(HwmonSensor&&) = delete;
+
+    static Id makeId(std::string_view service, std::string_view path);
+
+    Id id() const override;
+    std::string metadata() const override;
+    std::string getName() const override;
+    void registerForUpdates(
+        const std::weak_ptr<interfaces::SensorListener>& weakListener) override;
+    void unregisterFromUpdates(
+        const std::weak_ptr<interfaces::SensorListener>& weakListener) override;
+
+    LabeledSensorInfo getLabeledSensorInfo() const override;
+
+    void updateValue(double newValue, Milliseconds newTimestamp);
+
+  private:
+    interfaces::Sensor::Id sensorId;
+    std::string sensorMetadata;
+    HwmonScheduler& scheduler;
+
+    std::vector<std::weak_ptr<interfaces::SensorListener>> listeners;
+    Milliseconds timestamp = Milliseconds{0u};
+    std::optional<double> value;
+    bool scheduled = false;
+};
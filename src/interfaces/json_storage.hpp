@@ -6,6 +6,7 @@
 #include <filesystem>
 #include <optional>
 #include <string>
+#include <string_view>
 
 namespace interfaces
 {
@@ -19,10 +20,14 @@ class JsonStorage
     virtual ~JsonStorage() = default;
 
     virtual void store(const FilePath& subPath, const nlohmann::json& data) = 0;
+    virtual void storeSerialized(const FilePath& subPath,
+                                 std::string_view data) = 0;
     virtual bool remove(const FilePath& subPath) = 0;
     virtual bool exist(const FilePath& path) const = 0;
     virtual std::optional<nlohmann::json> load(
         const FilePath& subPath) const = 0;
+    virtual std::optional<std::string> loadSerialized(
+        const FilePath& subPath) const = 0;
     virtual std::vector<FilePath> list() const = 0;
 };
 
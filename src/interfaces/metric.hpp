@@ -2,6 +2,7 @@
 
 #include "interfaces/metric_listener.hpp"
 #include "metric_value.hpp"
+#include "types/collection_timestamp.hpp"
 #include "types/duration_types.hpp"
 #include "types/report_types.hpp"
 
@@ -19,7 +20,8 @@ class Metric
 
     virtual void initialize() = 0;
     virtual void deinitialize() = 0;
-    virtual const std::vector<MetricValue>& getUpdatedReadings() = 0;
+    virtual const std::vector<MetricValue>& getUpdatedReadings(
+        const CollectionTimestamp& timestamp) = 0;
     virtual LabeledMetricParameters dumpConfiguration() const = 0;
     virtual uint64_t metricCount() const = 0;
     virtual void registerForUpdates(interfaces::MetricListener& listener) = 0;
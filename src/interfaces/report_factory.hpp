@@ -1,5 +1,7 @@
 #pragma once
 
+#include "history/rollup.hpp"
+#include "history/store.hpp"
 #include "interfaces/json_storage.hpp"
 #include "interfaces/metric.hpp"
 #include "interfaces/report.hpp"
@@ -43,6 +45,19 @@ class ReportFactory
         ReportManager& reportManager, JsonStorage& reportStorage,
         std::vector<LabeledMetricParameters> labeledMetricParams, bool enabled,
         Readings) const = 0;
+
+    /** Returns nullptr when readings history is disabled */
+    virtual std::unique_ptr<history::Store> makeHistory(
+        const std::string& id) const = 0;
+    /** Removes readings history left by reports other than reportIds */
+    virtual void removeStaleHistory(
+        const std::vector<std::string>& reportIds) const = 0;
+
+    /** Returns nullptr when readings rollups are disabled */
+    virtual std::unique_ptr<history::Rollup> makeRollup() const = 0;
+
+    /** Whether append reports keep their readings compressed in memory */
+    virtual bool compressReadings() const = 0;
 };
 
 } // namespace interfaces
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "types/sensor_id.hpp"
 #include "types/sensor_types.hpp"
 
 #include <chrono>
@@ -18,27 +19,7 @@ class SensorListener;
 class Sensor
 {
   public:
-    struct Id
-    {
-        Id(std::string_view type, std::string_view service,
-           std::string_view path) : type(type), service(service), path(path)
-        {}
-
-        std::string type;
-        std::string service;
-        std::string path;
-
-        bool operator<(const Id& other) const
-        {
-            return std::tie(type, service, path) <
-                   std::tie(other.type, other.service, other.path);
-        }
-
-        inline std::string str() const
-        {
-            return type + ":" + service + ":" + path;
-        }
-    };
+    using Id = SensorId;
 
     virtual ~Sensor() = default;
 
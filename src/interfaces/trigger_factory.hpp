@@ -6,6 +6,7 @@
 #include "interfaces/trigger.hpp"
 #include "interfaces/trigger_manager.hpp"
 #include "sensor.hpp"
+#include "types/event_log_counters.hpp"
 #include "types/trigger_types.hpp"
 
 #include <boost/asio/spawn.hpp>
@@ -49,6 +50,8 @@ class TriggerFactory
     virtual void updateSensors(
         Sensors& currentSensors,
         const std::vector<LabeledSensorInfo>& labeledSensorsInfo) const = 0;
+
+    virtual EventLogCounters getEventLogCounters() const = 0;
 };
 
 } // namespace interfaces
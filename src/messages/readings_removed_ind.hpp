@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string_view>
+
+namespace messages
+{
+
+/** Sent by a report that stopped updating its readings */
+struct ReadingsRemovedInd
+{
+    std::string_view reportId;
+};
+
+} // namespace messages
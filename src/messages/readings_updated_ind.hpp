@@ -0,0 +1,17 @@
+#pragma once
+
+#include "types/readings.hpp"
+
+#include <string_view>
+
+namespace messages
+{
+
+/** Sent synchronously by a report after its readings were updated */
+struct ReadingsUpdatedInd
+{
+    std::string_view reportId;
+    const Readings& readings;
+};
+
+} // namespace messages
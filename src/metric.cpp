@@ -12,14 +12,12 @@
 
 Metric::Metric(Sensors sensorsIn, OperationType operationTypeIn,
                CollectionTimeScope timeScopeIn,
-               CollectionDuration collectionDurationIn,
-               std::unique_ptr<interfaces::Clock> clockIn) :
+               CollectionDuration collectionDurationIn) :
     sensors(std::move(sensorsIn)), operationType(operationTypeIn),
     collectionTimeScope(timeScopeIn), collectionDuration(collectionDurationIn),
     collectionAlgorithms(
         metrics::makeCollectionData(sensors.size(), operationType,
-                                    collectionTimeScope, collectionDuration)),
-    clock(std::move(clockIn))
+                                    collectionTimeScope, collectionDuration))
 {}
 
 void Metric::registerForUpdates(interfaces::MetricListener& listener)
@@ -53,16 +51,15 @@ void Metric::deinitialize()
     }
 }
 
-const std::vector<MetricValue>& Metric::getUpdatedReadings()
+const std::vector<MetricValue>& Metric::getUpdatedReadings(
+    const CollectionTimestamp& timestamp)
 {
-    const auto steadyTimestamp = clock->steadyTimestamp();
-    const auto systemTimestamp =
-        std::chrono::duration_cast<Milliseconds>(clock->systemTimestamp())
-            .count();
+    const auto systemTimestamp = timestamp.system.count();
 
     for (size_t i = 0; i < collectionAlgorithms.size(); ++i)
     {
-        if (const auto value = collectionAlgorithms[i]->update(steadyTimestamp))
+        if (const auto value =
+                collectionAlgorithms[i]->update(timestamp.steady))
         {
             if (i < readings.size())
             {
@@ -117,7 +114,7 @@ metrics::CollectionData& Metric::findAssociatedData(
 LabeledMetricParameters Metric::dumpConfiguration() const
 {
     auto sensorPath = utils::transform(sensors, [](const auto& sensor) {
-        return LabeledSensorInfo(sensor->id().service, sensor->id().path,
+        return LabeledSensorInfo(sensor->id().service(), sensor->id().path(),
                                  sensor->metadata());
     });
 
@@ -1,6 +1,5 @@
 #pragma once
 
-#include "interfaces/clock.hpp"
 #include "interfaces/metric.hpp"
 #include "interfaces/metric_listener.hpp"
 #include "interfaces/sensor.hpp"
@@ -15,11 +14,12 @@ class Metric :
 {
   public:
     Metric(Sensors sensors, OperationType operationType, CollectionTimeScope,
-           CollectionDuration, std::unique_ptr<interfaces::Clock>);
+           CollectionDuration);
 
     void initialize() override;
     void deinitialize() override;
-    const std::vector<MetricValue>& getUpdatedReadings() override;
+    const std::vector<MetricValue>& getUpdatedReadings(
+        const CollectionTimestamp& timestamp) override;
     void sensorUpdated(interfaces::Sensor&, Milliseconds,
                        double value) override;
     LabeledMetricParameters dumpConfiguration() const override;
@@ -39,6 +39,5 @@ class Metric :
     CollectionTimeScope collectionTimeScope;
     CollectionDuration collectionDuration;
     std::vector<std::unique_ptr<metrics::CollectionData>> collectionAlgorithms;
-    std::unique_ptr<interfaces::Clock> clock;
     std::vector<std::reference_wrapper<interfaces::MetricListener>> listeners;
 };
@@ -0,0 +1,93 @@
+#include "metric_report_renderer.hpp"
+
+#include "utils/json_writer.hpp"
+
+#include <chrono>
+#include <format>
+
+namespace
+{
+
+constexpr std::string_view metricReportsUri =
+    "/redfish/v1/TelemetryService/MetricReports/";
+constexpr std::string_view metricReportDefinitionsUri =
+    "/redfish/v1/TelemetryService/MetricReportDefinitions/";
+
+} // namespace
+
+MetricReportRenderer::MetricReportRenderer(std::string_view reportId)
+{
+    utils::JsonWriter json(prefix);
+    json.beginObject();
+    json.member("@odata.id", std::string(metricReportsUri) +
+                                 std::string(reportId));
+    json.member("@odata.type", "#MetricReport.v1_3_0.MetricReport");
+    json.member("Id", reportId);
+    json.key("MetricReportDefinition");
+    json.beginObject();
+    json.member("@odata.id", std::string(metricReportDefinitionsUri) +
+                                 std::string(reportId));
+    json.endObject();
+    json.member("Name", reportId);
+    prefix.append(",\"MetricValues\":[");
+}
+
+void MetricReportRenderer::appendDateTime(std::string& out,
+                                          uint64_t milliseconds)
+{
+    using namespace std::chrono;
+
+    const sys_time<std::chrono::milliseconds> time{
+        std::chrono::milliseconds(milliseconds)};
+    const auto day = floor<days>(time);
+    const year_month_day date{day};
+    const hh_mm_ss clock{time - day};
+
+    std::format_to(std::back_inserter(out),
+                   "{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:03}+00:00",
+                   static_cast<int>(date.year()),
+                   static_cast<unsigned>(date.month()),
+                   static_cast<unsigned>(date.day()), clock.hours().count(),
+                   clock.minutes().count(), clock.seconds().count(),
+                   clock.subseconds().count());
+}
+
+const std::string& MetricReportRenderer::metricPrefix(
+    const std::string& metricId)
+{
+    auto [it, inserted] = metricPrefixes.try_emplace(metricId);
+    if (inserted)
+    {
+        utils::JsonWriter json(it->second);
+        json.beginObject();
+        json.member("MetricId", metricId);
+        it->second.append(",\"MetricValue\":\"");
+    }
+    return it->second;
+}
+
+void MetricReportRenderer::render(const Readings& readings)
+{
+    const auto& [timestamp, values] = readings;
+
+    document.assign(prefix);
+    bool first = true;
+    for (const auto& [metricId, value, readingTimestamp] : values)
+    {
+        if (!first)
+        {
+            document.push_back(',');
+        }
+        first = false;
+
+        document.append(metricPrefix(metricId));
+        // bmcweb reports values with std::to_string
+        document.append(std::to_string(value));
+        document.append("\",\"Timestamp\":\"");
+        appendDateTime(document, readingTimestamp);
+        document.append("\"}");
+    }
+    document.append("],\"Timestamp\":\"");
+    appendDateTime(document, timestamp);
+    document.append("\"}");
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "types/readings.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/** Keeps a serialized Redfish MetricReport document of a single report.
+ *
+ *  The document matches what bmcweb builds from Report.Readings. Parts
+ *  that don't depend on readings are rendered once, readings only rewrite
+ *  the values and timestamps. */
+class MetricReportRenderer
+{
+  public:
+    explicit MetricReportRenderer(std::string_view reportId);
+
+    void render(const Readings& readings);
+
+    const std::string& get() const
+    {
+        return document;
+    }
+
+    /** Formats milliseconds since epoch the way Redfish expects them */
+    static void appendDateTime(std::string& out, uint64_t milliseconds);
+
+  private:
+    std::string prefix;
+    std::unordered_map<std::string, std::string> metricPrefixes;
+    std::string document;
+
+    const std::string& metricPrefix(const std::string& metricId);
+};
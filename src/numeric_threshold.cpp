@@ -1,119 +1,109 @@
 #include "numeric_threshold.hpp"
 
-#include <phosphor-logging/log.hpp>
+#include "numeric_threshold_table.hpp"
 
 NumericThreshold::NumericThreshold(
-    boost::asio::io_context& ioc, const std::string& triggerIdIn,
-    Sensors sensorsIn,
+    utils::TimerWheel& timerWheel,
+    const std::string& triggerIdIn, Sensors sensorsIn,
     std::vector<std::unique_ptr<interfaces::TriggerAction>> actionsIn,
     Milliseconds dwellTimeIn, numeric::Direction directionIn,
     double thresholdValueIn, numeric::Type typeIn,
-    std::unique_ptr<interfaces::Clock> clockIn) :
-    ioc(ioc), triggerId(triggerIdIn), actions(std::move(actionsIn)),
-    dwellTime(dwellTimeIn), direction(directionIn),
-    thresholdValue(thresholdValueIn), type(typeIn), clock(std::move(clockIn))
+    std::unique_ptr<interfaces::Clock> clockIn,
+    NumericThresholdTables& tables) :
+    timerWheel(timerWheel), triggerId(triggerIdIn),
+    actions(std::move(actionsIn)), dwellTime(dwellTimeIn),
+    direction(directionIn),
+    thresholdValue(thresholdValueIn), type(typeIn), clock(std::move(clockIn)),
+    tables(tables)
 {
     for (const auto& sensor : sensorsIn)
     {
-        sensorDetails.emplace(sensor, makeDetails(sensor->getName()));
+        sensorDetails.emplace(sensor, makeDetails(sensor));
     }
 }
 
-void NumericThreshold::initialize()
-{
-    ThresholdOperations::initialize(this);
-}
-
-void NumericThreshold::updateSensors(Sensors newSensors)
-{
-    ThresholdOperations::updateSensors(this, std::move(newSensors));
-}
-
-NumericThreshold::ThresholdDetail& NumericThreshold::getDetails(
-    const interfaces::Sensor& sensor)
+NumericThreshold::~NumericThreshold()
 {
-    return ThresholdOperations::getDetails(this, sensor);
+    if (initialized)
+    {
+        for ([[maybe_unused]] auto& [sensor, detail] : sensorDetails)
+        {
+            detail->table->remove(*detail);
+        }
+    }
 }
 
-std::shared_ptr<NumericThreshold::ThresholdDetail>
-    NumericThreshold::makeDetails(const std::string& sensorName)
+void NumericThreshold::initialize()
 {
-    return std::make_shared<ThresholdDetail>(sensorName, ioc);
+    for ([[maybe_unused]] auto& [sensor, detail] : sensorDetails)
+    {
+        detail->table->add(thresholdValue, *this, *detail);
+    }
+    initialized = true;
 }
 
-void NumericThreshold::sensorUpdated(interfaces::Sensor& sensor,
-                                     Milliseconds timestamp, double value)
+void NumericThreshold::updateSensors(Sensors newSensors)
 {
-    auto& details = getDetails(sensor);
-    auto& prevValue = details.prevValue;
-    auto& prevDirection = details.prevDirection;
-    auto& dwell = details.dwell;
-    auto& timer = details.timer;
+    SensorDetails newSensorDetails;
 
-    if (!prevValue)
+    for (const auto& sensor : newSensors)
     {
-        prevValue = value;
-        return;
+        if (auto it = sensorDetails.find(sensor); it != sensorDetails.end())
+        {
+            newSensorDetails.emplace(*it);
+            sensorDetails.erase(it);
+            continue;
+        }
+
+        auto& detail = newSensorDetails.emplace(sensor, makeDetails(sensor))
+                           .first->second;
+        if (initialized)
+        {
+            detail->table->add(thresholdValue, *this, *detail);
+        }
     }
 
-    bool crossedDecreasing =
-        thresholdValue < prevValue && thresholdValue > value;
-    bool crossedIncreasing =
-        thresholdValue > prevValue && thresholdValue < value;
-
-    if (!crossedDecreasing && !crossedIncreasing && thresholdValue == prevValue)
+    if (initialized)
     {
-        crossedDecreasing = prevDirection == numeric::Direction::decreasing &&
-                            thresholdValue > value;
-        crossedIncreasing = prevDirection == numeric::Direction::increasing &&
-                            thresholdValue < value;
+        for ([[maybe_unused]] auto& [sensor, detail] : sensorDetails)
+        {
+            detail->table->remove(*detail);
+        }
     }
 
-    if (dwell && (crossedIncreasing || crossedDecreasing))
-    {
-        timer.cancel();
-        dwell = false;
-    }
-    if ((direction == numeric::Direction::decreasing && crossedDecreasing) ||
-        (direction == numeric::Direction::increasing && crossedIncreasing) ||
-        (direction == numeric::Direction::either &&
-         (crossedIncreasing || crossedDecreasing)))
+    sensorDetails = std::move(newSensorDetails);
+}
+
+std::shared_ptr<NumericThreshold::ThresholdDetail>
+    NumericThreshold::makeDetails(
+        const std::shared_ptr<interfaces::Sensor>& sensor)
+{
+    return std::make_shared<ThresholdDetail>(sensor->getName(), *this,
+                                             timerWheel, tables.get(sensor));
+}
+
+void NumericThreshold::crossed(ThresholdDetail& details, double value,
+                               numeric::Direction crossingDirection)
+{
+    details.timer.cancel();
+    if (direction == numeric::Direction::either ||
+        direction == crossingDirection)
     {
         startTimer(details, value);
     }
-
-    prevDirection = value > prevValue   ? numeric::Direction::increasing
-                    : value < prevValue ? numeric::Direction::decreasing
-                                        : numeric::Direction::either;
-    prevValue = value;
 }
 
 void NumericThreshold::startTimer(NumericThreshold::ThresholdDetail& details,
                                   double value)
 {
-    auto& sensorName = details.getSensorName();
-    auto& dwell = details.dwell;
-    auto& timer = details.timer;
-
     if (dwellTime == Milliseconds::zero())
     {
-        commit(sensorName, value);
+        commit(details.getSensorName(), value);
     }
     else
     {
-        dwell = true;
-        timer.expires_after(dwellTime);
-        timer.async_wait([this, &sensorName, &dwell,
-                          value](const boost::system::error_code ec) {
-            if (ec)
-            {
-                phosphor::logging::log<phosphor::logging::level::DEBUG>(
-                    "Timer has been canceled");
-                return;
-            }
-            commit(sensorName, value);
-            dwell = false;
-        });
+        details.dwellValue = value;
+        details.timer.start(dwellTime);
     }
 }
 
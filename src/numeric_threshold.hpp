@@ -2,46 +2,44 @@
 
 #include "interfaces/clock.hpp"
 #include "interfaces/sensor.hpp"
-#include "interfaces/sensor_listener.hpp"
 #include "interfaces/threshold.hpp"
 #include "interfaces/trigger_action.hpp"
 #include "types/duration_types.hpp"
 #include "types/trigger_types.hpp"
-#include "utils/threshold_operations.hpp"
-
-#include <boost/asio/steady_timer.hpp>
+#include "utils/timer_wheel.hpp"
 
 #include <chrono>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
-class NumericThreshold :
-    public interfaces::Threshold,
-    public interfaces::SensorListener,
-    public std::enable_shared_from_this<NumericThreshold>
+class NumericThresholdTable;
+class NumericThresholdTables;
+
+class NumericThreshold : public interfaces::Threshold
 {
   public:
     NumericThreshold(
-        boost::asio::io_context& ioc, const std::string& triggerId,
+        utils::TimerWheel& timerWheel, const std::string& triggerId,
         Sensors sensors,
         std::vector<std::unique_ptr<interfaces::TriggerAction>> actions,
         Milliseconds dwellTime, numeric::Direction direction,
         double thresholdValue, numeric::Type type,
-        std::unique_ptr<interfaces::Clock> clock);
-    ~NumericThreshold() = default;
+        std::unique_ptr<interfaces::Clock> clock,
+        NumericThresholdTables& tables);
+    ~NumericThreshold();
     NumericThreshold(const NumericThreshold&) = delete;
     NumericThreshold& operator=(const NumericThreshold&) = delete;
     NumericThreshold(NumericThreshold&&) = delete;
     NumericThreshold& operator=(NumericThreshold&&) = delete;
 
     void initialize() override;
-    void sensorUpdated(interfaces::Sensor&, Milliseconds, double) override;
     LabeledThresholdParam getThresholdParam() const override;
     void updateSensors(Sensors newSensors) override;
 
   private:
-    boost::asio::io_context& ioc;
+    utils::TimerWheel& timerWheel;
     const std::string& triggerId;
     const std::vector<std::unique_ptr<interfaces::TriggerAction>> actions;
     const Milliseconds dwellTime;
@@ -50,17 +48,23 @@ class NumericThreshold :
     const numeric::Type type;
     bool initialized = false;
     std::unique_ptr<interfaces::Clock> clock;
+    NumericThresholdTables& tables;
 
     struct ThresholdDetail
     {
-        std::optional<double> prevValue = std::nullopt;
-        numeric::Direction prevDirection = numeric::Direction::either;
-        bool dwell = false;
-        boost::asio::steady_timer timer;
+        double dwellValue = 0.0;
+        utils::TimerWheel::Timer timer;
+        std::shared_ptr<NumericThresholdTable> table;
 
         ThresholdDetail(const std::string& sensorNameIn,
-                        boost::asio::io_context& ioc) :
-            timer(ioc), sensorName(sensorNameIn)
+                        NumericThreshold& threshold,
+                        utils::TimerWheel& timerWheel,
+                        std::shared_ptr<NumericThresholdTable> table) :
+            timer(timerWheel,
+                  [this, &threshold] {
+                      threshold.commit(sensorName, dwellValue);
+                  }),
+            table(std::move(table)), sensorName(sensorNameIn)
         {}
         ~ThresholdDetail() = default;
         ThresholdDetail(const ThresholdDetail&) = delete;
@@ -81,10 +85,11 @@ class NumericThreshold :
                            std::shared_ptr<ThresholdDetail>>;
     SensorDetails sensorDetails;
 
-    friend ThresholdOperations;
+    friend NumericThresholdTable;
 
+    void crossed(ThresholdDetail&, double, numeric::Direction);
     void startTimer(ThresholdDetail&, double);
     void commit(const std::string&, double);
-    ThresholdDetail& getDetails(const interfaces::Sensor& sensor);
-    std::shared_ptr<ThresholdDetail> makeDetails(const std::string& sensorName);
+    std::shared_ptr<ThresholdDetail> makeDetails(
+        const std::shared_ptr<interfaces::Sensor>& sensor);
 };
@@ -0,0 +1,113 @@
+#include "numeric_threshold_table.hpp"
+
+#include <algorithm>
+
+NumericThresholdTable::NumericThresholdTable(
+    const std::shared_ptr<interfaces::Sensor>& sensor) : sensor(sensor)
+{}
+
+void NumericThresholdTable::add(double value, NumericThreshold& threshold,
+                                NumericThreshold::ThresholdDetail& detail)
+{
+    auto it = std::ranges::upper_bound(entries, value, {}, &Entry::value);
+    entries.insert(it, Entry{value, &threshold, &detail});
+
+    if (!registered)
+    {
+        if (auto sensorPtr = sensor.lock())
+        {
+            registered = true;
+            sensorPtr->registerForUpdates(weak_from_this());
+        }
+    }
+}
+
+void NumericThresholdTable::remove(
+    const NumericThreshold::ThresholdDetail& detail)
+{
+    std::erase_if(entries, [&detail](const auto& entry) {
+        return entry.detail == &detail;
+    });
+
+    if (entries.empty() && registered)
+    {
+        registered = false;
+        prevValue = std::nullopt;
+        if (auto sensorPtr = sensor.lock())
+        {
+            sensorPtr->unregisterFromUpdates(weak_from_this());
+        }
+    }
+}
+
+void NumericThresholdTable::sensorUpdated(interfaces::Sensor&, Milliseconds,
+                                          double value)
+{
+    if (!prevValue)
+    {
+        prevValue = value;
+        return;
+    }
+
+    const auto [low, high] = std::minmax(*prevValue, value);
+    const auto first =
+        std::ranges::lower_bound(entries, low, {}, &Entry::value);
+    const auto last = std::ranges::upper_bound(first, entries.end(), high, {},
+                                               &Entry::value);
+
+    for (auto it = first; it != last; ++it)
+    {
+        const auto thresholdValue = it->value;
+
+        bool crossedDecreasing =
+            thresholdValue < prevValue && thresholdValue > value;
+        bool crossedIncreasing =
+            thresholdValue > prevValue && thresholdValue < value;
+
+        if (!crossedDecreasing && !crossedIncreasing &&
+            thresholdValue == prevValue)
+        {
+            crossedDecreasing =
+                prevDirection == numeric::Direction::decreasing &&
+                thresholdValue > value;
+            crossedIncreasing =
+                prevDirection == numeric::Direction::increasing &&
+                thresholdValue < value;
+        }
+
+        if (crossedIncreasing)
+        {
+            it->threshold->crossed(*it->detail, value,
+                                   numeric::Direction::increasing);
+        }
+        else if (crossedDecreasing)
+        {
+            it->threshold->crossed(*it->detail, value,
+                                   numeric::Direction::decreasing);
+        }
+    }
+
+    prevDirection = value > prevValue   ? numeric::Direction::increasing
+                    : value < prevValue ? numeric::Direction::decreasing
+                                        : numeric::Direction::either;
+    prevValue = value;
+}
+
+std::shared_ptr<NumericThresholdTable> NumericThresholdTables::get(
+    const std::shared_ptr<interfaces::Sensor>& sensor)
+{
+    if (auto it = tables.find(sensor.get()); it != tables.end())
+    {
+        if (auto table = it->second.lock())
+        {
+            return table;
+        }
+    }
+
+    std::erase_if(tables,
+                  [](const auto& item) { return item.second.expired(); });
+
+    auto table = std::make_shared<NumericThresholdTable>(sensor);
+    tables.emplace(sensor.get(), table);
+    return table;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "interfaces/sensor.hpp"
+#include "interfaces/sensor_listener.hpp"
+#include "numeric_threshold.hpp"
+#include "types/trigger_types.hpp"
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+/** Numeric thresholds of all triggers watching one sensor.
+ *
+ * The table is the only listener registered on the sensor. Thresholds are
+ * kept sorted by value, so an update locates the crossed ones with a binary
+ * search over [previous value, value] and evaluates only those.
+ */
+class NumericThresholdTable :
+    public interfaces::SensorListener,
+    public std::enable_shared_from_this<NumericThresholdTable>
+{
+  public:
+    explicit NumericThresholdTable(
+        const std::shared_ptr<interfaces::Sensor>& sensor);
+
+    void add(double value, NumericThreshold& threshold,
+             NumericThreshold::ThresholdDetail& detail);
+    void remove(const NumericThreshold::ThresholdDetail& detail);
+
+    void sensorUpdated(interfaces::Sensor&, Milliseconds, double) override;
+
+  private:
+    struct Entry
+    {
+        double value;
+        NumericThreshold* threshold;
+        NumericThreshold::ThresholdDetail* detail;
+    };
+
+    std::weak_ptr<interfaces::Sensor> sensor;
+    std::vector<Entry> entries;
+    bool registered = false;
+    std::optional<double> prevValue;
+    numeric::Direction prevDirection = numeric::Direction::either;
+};
+
+/** Hands out the shared NumericThresholdTable of each sensor. */
+class NumericThresholdTables
+{
+  public:
+    std::shared_ptr<NumericThresholdTable>
+        get(const std::shared_ptr<interfaces::Sensor>& sensor);
+
+  private:
+    std::unordered_map<const interfaces::Sensor*,
+                       std::weak_ptr<NumericThresholdTable>>
+        tables;
+};
@@ -0,0 +1,328 @@
+#include "open_metrics_exporter.hpp"
+
+#include "messages/readings_removed_ind.hpp"
+#include "messages/readings_updated_ind.hpp"
+
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include <phosphor-logging/log.hpp>
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <vector>
+
+namespace
+{
+
+constexpr std::string_view metricsHeader =
+    "# TYPE telemetry_reading gauge\n"
+    "# HELP telemetry_reading Latest readings of telemetry reports\n";
+constexpr std::string_view metricsTrailer = "# EOF\n";
+constexpr size_t maxRequestSize = 4096;
+
+void appendLabelValue(std::string& out, std::string_view value)
+{
+    for (char c : value)
+    {
+        switch (c)
+        {
+            case '\\':
+                out.append("\\\\");
+                break;
+            case '"':
+                out.append("\\\"");
+                break;
+            case '\n':
+                out.append("\\n");
+                break;
+            default:
+                out.push_back(c);
+                break;
+        }
+    }
+}
+
+void appendValue(std::string& out, double value)
+{
+    if (std::isnan(value))
+    {
+        out.append("NaN");
+        return;
+    }
+    if (std::isinf(value))
+    {
+        out.append(value > 0 ? "+Inf" : "-Inf");
+        return;
+    }
+
+    std::array<char, 32> buffer;
+    auto [end, ec] = std::to_chars(buffer.begin(), buffer.end(), value);
+    out.append(buffer.begin(), end);
+}
+
+/** OpenMetrics timestamps are seconds, readings carry milliseconds */
+void appendTimestamp(std::string& out, uint64_t milliseconds)
+{
+    std::array<char, 24> buffer;
+    auto [end, ec] =
+        std::to_chars(buffer.begin(), buffer.end(), milliseconds / 1000);
+    out.append(buffer.begin(), end);
+
+    const auto fraction = milliseconds % 1000;
+    out.push_back('.');
+    out.push_back(static_cast<char>('0' + fraction / 100));
+    out.push_back(static_cast<char>('0' + fraction / 10 % 10));
+    out.push_back(static_cast<char>('0' + fraction % 10));
+}
+
+} // namespace
+
+class OpenMetricsExporter::Session :
+    public std::enable_shared_from_this<OpenMetricsExporter::Session>
+{
+  public:
+    Session(boost::asio::local::stream_protocol::socket socketIn,
+            std::vector<std::shared_ptr<std::string>> texts,
+            std::shared_ptr<size_t> sessionsIn) :
+        socket(std::move(socketIn)), deadline(socket.get_executor()),
+        texts(std::move(texts)), request(maxRequestSize),
+        sessions(std::move(sessionsIn))
+    {
+        ++*sessions;
+    }
+
+    ~Session()
+    {
+        --*sessions;
+    }
+
+    Session(const Session&) = delete;
+    Session& operator=(const Session&) = delete;
+
+    void start()
+    {
+        deadline.expires_after(sessionTimeout);
+        deadline.async_wait(
+            [self = shared_from_this()](boost::system::error_code ec) {
+                if (!ec)
+                {
+                    boost::system::error_code ignored;
+                    self->socket.close(ignored);
+                }
+            });
+
+        boost::asio::async_read_until(
+            socket, request, "\r\n\r\n",
+            [self = shared_from_this()](boost::system::error_code ec, size_t) {
+                if (ec)
+                {
+                    self->deadline.cancel();
+                    return;
+                }
+                self->respond();
+            });
+    }
+
+  private:
+    void respond()
+    {
+        size_t contentLength = metricsHeader.size() + metricsTrailer.size();
+        for (const auto& text : texts)
+        {
+            contentLength += text->size();
+        }
+
+        responseHeader = std::format(
+            "HTTP/1.0 200 OK\r\n"
+            "Content-Type: application/openmetrics-text; version=1.0.0; "
+            "charset=utf-8\r\n"
+            "Content-Length: {}\r\nConnection: close\r\n\r\n",
+            contentLength);
+
+        std::vector<boost::asio::const_buffer> buffers;
+        buffers.reserve(texts.size() + 3);
+        buffers.emplace_back(boost::asio::buffer(responseHeader));
+        buffers.emplace_back(boost::asio::buffer(metricsHeader));
+        for (const auto& text : texts)
+        {
+            buffers.emplace_back(boost::asio::buffer(*text));
+        }
+        buffers.emplace_back(boost::asio::buffer(metricsTrailer));
+
+        boost::asio::async_write(
+            socket, buffers,
+            [self = shared_from_this()](boost::system::error_code, size_t) {
+                self->deadline.cancel();
+                boost::system::error_code ignored;
+                self->socket.shutdown(
+                    boost::asio::local::stream_protocol::socket::shutdown_both,
+                    ignored);
+            });
+    }
+
+    boost::asio::local::stream_protocol::socket socket;
+    boost::asio::steady_timer deadline;
+    std::vector<std::shared_ptr<std::string>> texts;
+    boost::asio::streambuf request;
+    std::string responseHeader;
+    std::shared_ptr<size_t> sessions;
+};
+
+OpenMetricsExporter::OpenMetricsExporter(boost::asio::io_context& ioc,
+                                         std::filesystem::path socketPathIn) :
+    acceptor(ioc), socketPath(std::move(socketPathIn)), messanger(ioc)
+{
+    std::error_code ec;
+    std::filesystem::remove(socketPath, ec);
+
+    const boost::asio::local::stream_protocol::endpoint endpoint(
+        socketPath.string());
+    acceptor.open(endpoint.protocol());
+    acceptor.bind(endpoint);
+    acceptor.listen();
+
+    messanger.on_receive<messages::ReadingsUpdatedInd>(
+        [this](const auto& msg) { update(msg.reportId, msg.readings); });
+    messanger.on_receive<messages::ReadingsRemovedInd>(
+        [this](const auto& msg) { remove(msg.reportId); });
+
+    accept();
+}
+
+OpenMetricsExporter::~OpenMetricsExporter()
+{
+    std::error_code ec;
+    std::filesystem::remove(socketPath, ec);
+}
+
+const std::string& OpenMetricsExporter::linePrefix(ReportText& report,
+                                                   std::string_view reportId,
+                                                   const std::string& metricId)
+{
+    auto [it, inserted] = report.linePrefixes.try_emplace(metricId);
+    if (inserted)
+    {
+        auto& prefix = it->second;
+        prefix.append(metricName);
+        prefix.append("{report=\"");
+        appendLabelValue(prefix, reportId);
+        prefix.append("\",metric=\"");
+        appendLabelValue(prefix, metricId);
+        prefix.append("\"} ");
+    }
+    return it->second;
+}
+
+void OpenMetricsExporter::update(std::string_view reportId,
+                                 const Readings& readings)
+{
+    auto it = reports.find(reportId);
+    if (it == reports.end())
+    {
+        it = reports.emplace(std::string(reportId), ReportText{}).first;
+    }
+    auto& report = it->second;
+
+    if (report.text.use_count() > 1)
+    {
+        auto text = std::make_shared<std::string>();
+        text->reserve(report.text->size());
+        report.text = std::move(text);
+    }
+
+    for (const auto& reading : std::get<1>(readings))
+    {
+        auto [index, inserted] =
+            latestIndexes.try_emplace(std::get<0>(reading), latest.size());
+        if (inserted)
+        {
+            latest.emplace_back(&reading);
+        }
+        else if (std::get<2>(reading) >= std::get<2>(*latest[index->second]))
+        {
+            latest[index->second] = &reading;
+        }
+    }
+
+    auto& text = *report.text;
+    text.clear();
+    for (const auto* reading : latest)
+    {
+        const auto& [metricId, value, timestamp] = *reading;
+        text.append(linePrefix(report, reportId, metricId));
+        appendValue(text, value);
+        text.push_back(' ');
+        appendTimestamp(text, timestamp);
+        text.push_back('\n');
+    }
+
+    if (report.linePrefixes.size() > latest.size())
+    {
+        std::erase_if(report.linePrefixes, [this](const auto& item) {
+            return !latestIndexes.contains(item.first);
+        });
+    }
+
+    // Both point into readings, which do not outlive this call
+    latest.clear();
+    latestIndexes.clear();
+}
+
+void OpenMetricsExporter::remove(std::string_view reportId)
+{
+    if (auto it = reports.find(reportId); it != reports.end())
+    {
+        reports.erase(it);
+    }
+}
+
+std::string OpenMetricsExporter::render() const
+{
+    std::string result(metricsHeader);
+    for (const auto& [id, report] : reports)
+    {
+        result.append(*report.text);
+    }
+    result.append(metricsTrailer);
+    return result;
+}
+
+void OpenMetricsExporter::accept()
+{
+    acceptor.async_accept([this](boost::system::error_code ec,
+                                 boost::asio::local::stream_protocol::socket
+                                     socket) {
+        if (ec == boost::asio::error::operation_aborted)
+        {
+            return;
+        }
+        if (ec)
+        {
+            phosphor::logging::log<phosphor::logging::level::ERR>(
+                "Failed to accept OpenMetrics connection",
+                phosphor::logging::entry("ERROR=%s", ec.message().c_str()));
+        }
+        else if (*sessions >= maxSessions)
+        {
+            boost::system::error_code ignored;
+            socket.close(ignored);
+        }
+        else
+        {
+            std::vector<std::shared_ptr<std::string>> texts;
+            texts.reserve(reports.size());
+            for (const auto& [id, report] : reports)
+            {
+                texts.emplace_back(report.text);
+            }
+            std::make_shared<Session>(std::move(socket), std::move(texts),
+                                      sessions)
+                ->start();
+        }
+        accept();
+    });
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "types/duration_types.hpp"
+#include "types/readings.hpp"
+#include "utils/messanger.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/** Serves latest readings of active reports in OpenMetrics text format.
+ *
+ *  Readings are rendered when a report updates them, every report keeps its
+ *  own text buffer and caches the label part of each sample line. Only the
+ *  newest reading of each metric is exported, as a label set may appear
+ *  once per exposition and append reports keep older readings. A scrape
+ *  answers a HTTP request on the Unix socket by gathering all buffers into
+ *  a single write, no formatting happens per scrape. The number of open
+ *  connections and their lifetime are limited, so idle clients can't pin
+ *  memory or file descriptors. */
+class OpenMetricsExporter
+{
+  public:
+    static constexpr std::string_view metricName = "telemetry_reading";
+    /** Further connections are closed right after they are accepted */
+    static constexpr size_t maxSessions = 8;
+    /** Time a client has to send its request and read the response */
+    static constexpr Milliseconds sessionTimeout = Milliseconds(2000);
+
+    OpenMetricsExporter(boost::asio::io_context& ioc,
+                        std::filesystem::path socketPath);
+    ~OpenMetricsExporter();
+    OpenMetricsExporter(const OpenMetricsExporter&) = delete;
+    OpenMetricsExporter& operator=(const OpenMetricsExporter&) = delete;
+    OpenMetricsExporter(OpenMetricsExporter&&) = delete;
+    OpenMetricsExporter& operator=(OpenMetricsExporter&&) = delete;
+
+    void update(std::string_view reportId, const Readings& readings);
+    void remove(std::string_view reportId);
+
+    /** Body of the scrape response */
+    std::string render() const;
+
+  private:
+    struct ReportText
+    {
+        /** Shared with scrapes in progress, replaced instead of modified
+         *  while a scrape still holds it */
+        std::shared_ptr<std::string> text = std::make_shared<std::string>();
+        std::unordered_map<std::string, std::string> linePrefixes;
+    };
+
+    class Session;
+
+    boost::asio::local::stream_protocol::acceptor acceptor;
+    std::filesystem::path socketPath;
+    std::shared_ptr<size_t> sessions = std::make_shared<size_t>(0);
+    std::map<std::string, ReportText, std::less<>> reports;
+    /** Newest reading of every metric, reused between updates */
+    std::vector<const ReadingData*> latest;
+    std::unordered_map<std::string_view, size_t> latestIndexes;
+    utils::Messanger messanger;
+
+    const std::string& linePrefix(ReportText& report,
+                                  std::string_view reportId,
+                                  const std::string& metricId);
+    void accept();
+};
@@ -32,6 +32,12 @@ PersistentJsonStorage::PersistentJsonStorage(const DirectoryPath& directory) :
 
 void PersistentJsonStorage::store(const FilePath& filePath,
                                   const nlohmann::json& data)
+{
+    storeSerialized(filePath, data.dump());
+}
+
+void PersistentJsonStorage::storeSerialized(const FilePath& filePath,
+                                            std::string_view data)
 {
     try
     {
@@ -52,7 +58,7 @@ void PersistentJsonStorage::store(const FilePath& filePath,
         assertThatPathIsNotSymlink(path);
 
         std::ofstream file(path);
-        file << data;
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
         if (!file)
         {
             throw std::runtime_error("Unable to create file: " + path.string());
@@ -121,6 +127,37 @@ std::optional<nlohmann::json> PersistentJsonStorage::load(
     return result;
 }
 
+std::optional<std::string> PersistentJsonStorage::loadSerialized(
+    const FilePath& filePath) const
+{
+    const auto path = join(directory, filePath);
+    if (!std::filesystem::exists(path))
+    {
+        return std::nullopt;
+    }
+
+    std::string result;
+
+    try
+    {
+        assertThatPathIsNotSymlink(path);
+        std::ifstream file(path, std::ios::binary);
+        result.resize(std::filesystem::file_size(path));
+        file.read(result.data(), static_cast<std::streamsize>(result.size()));
+        if (!file)
+        {
+            throw std::runtime_error("Unable to read file: " + path.string());
+        }
+    }
+    catch (const std::exception& e)
+    {
+        phosphor::logging::log<phosphor::logging::level::ERR>(e.what());
+        return std::nullopt;
+    }
+
+    return result;
+}
+
 std::vector<interfaces::JsonStorage::FilePath> PersistentJsonStorage::list()
     const
 {
@@ -8,9 +8,13 @@ class PersistentJsonStorage : public interfaces::JsonStorage
     explicit PersistentJsonStorage(const DirectoryPath& directory);
 
     void store(const FilePath& subPath, const nlohmann::json& data) override;
+    void storeSerialized(const FilePath& subPath,
+                         std::string_view data) override;
     bool remove(const FilePath& subPath) override;
     bool exist(const FilePath& path) const override;
     std::optional<nlohmann::json> load(const FilePath& subPath) const override;
+    std::optional<std::string> loadSerialized(
+        const FilePath& subPath) const override;
     std::vector<FilePath> list() const override;
 
   private:
@@ -0,0 +1,255 @@
+#include "readings_export.hpp"
+
+#include "utils/dbus_path_utils.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <system_error>
+
+namespace
+{
+
+constexpr size_t cacheLineSize = 64;
+constexpr size_t maxReadAttempts = 64;
+
+size_t alignUp(size_t value)
+{
+    return (value + cacheLineSize - 1) / cacheLineSize * cacheLineSize;
+}
+
+[[noreturn]] void throwErrno(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+} // namespace
+
+ReadingsExport::ReadingsExport(size_t recordCapacityIn) :
+    recordCapacity(recordCapacityIn), metadataCapacity(recordCapacityIn),
+    stringsSize(recordCapacityIn * (utils::constants::maxIdNameLength + 1))
+{
+    const size_t recordsOffset = alignUp(sizeof(Header));
+    const size_t metadataOffset =
+        alignUp(recordsOffset + recordCapacity * sizeof(Record));
+    const size_t stringsOffset =
+        alignUp(metadataOffset + metadataCapacity * sizeof(Metadata));
+    mappingSize = alignUp(stringsOffset + stringsSize);
+
+    fd = utils::FileDescriptor(
+        ::memfd_create("telemetry-readings", MFD_CLOEXEC | MFD_ALLOW_SEALING));
+    if (fd.get() < 0)
+    {
+        throwErrno("memfd_create");
+    }
+    if (::ftruncate(fd.get(), static_cast<off_t>(mappingSize)) != 0)
+    {
+        throwErrno("ftruncate");
+    }
+    if (::fcntl(fd.get(), F_ADD_SEALS,
+                F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0)
+    {
+        throwErrno("F_ADD_SEALS");
+    }
+
+    void* address = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE,
+                           MAP_SHARED, fd.get(), 0);
+    if (address == MAP_FAILED)
+    {
+        throwErrno("mmap");
+    }
+    mapping = static_cast<std::byte*>(address);
+
+    readOnlyFd = utils::FileDescriptor(
+        ::open(("/proc/self/fd/" + std::to_string(fd.get())).c_str(),
+               O_RDONLY | O_CLOEXEC));
+    if (readOnlyFd.get() < 0)
+    {
+        const int error = errno;
+        ::munmap(mapping, mappingSize);
+        throw std::system_error(error, std::generic_category(), "open");
+    }
+
+    auto* h = new (mapping) Header{};
+    h->magic = magic;
+    h->version = version;
+    h->recordCapacity = static_cast<uint32_t>(recordCapacity);
+    h->recordsOffset = static_cast<uint32_t>(recordsOffset);
+    h->metadataCapacity = static_cast<uint32_t>(metadataCapacity);
+    h->metadataOffset = static_cast<uint32_t>(metadataOffset);
+    h->stringsOffset = static_cast<uint32_t>(stringsOffset);
+    h->stringsSize = static_cast<uint32_t>(stringsSize);
+}
+
+ReadingsExport::~ReadingsExport()
+{
+    ::munmap(mapping, mappingSize);
+}
+
+size_t ReadingsExport::defaultCapacity()
+{
+    return std::max<size_t>(TELEMETRY_MAX_APPEND_LIMIT,
+                            TELEMETRY_MAX_READING_PARAMS);
+}
+
+ReadingsExport::Header& ReadingsExport::header()
+{
+    return *std::launder(reinterpret_cast<Header*>(mapping));
+}
+
+ReadingsExport::Record* ReadingsExport::records()
+{
+    return reinterpret_cast<Record*>(mapping + header().recordsOffset);
+}
+
+ReadingsExport::Metadata* ReadingsExport::metadata()
+{
+    return reinterpret_cast<Metadata*>(mapping + header().metadataOffset);
+}
+
+char* ReadingsExport::strings()
+{
+    return reinterpret_cast<char*>(mapping + header().stringsOffset);
+}
+
+uint32_t ReadingsExport::intern(const std::string& metricId)
+{
+    if (auto it = metadataIndexes.find(metricId); it != metadataIndexes.end())
+    {
+        return it->second;
+    }
+
+    if (metadataIndexes.size() == metadataCapacity ||
+        stringsSize - stringsUsed < metricId.size() + 1)
+    {
+        return noMetadata;
+    }
+
+    const auto index = static_cast<uint32_t>(metadataIndexes.size());
+    std::memcpy(strings() + stringsUsed, metricId.c_str(),
+                metricId.size() + 1);
+    metadata()[index] =
+        Metadata{.offset = stringsUsed,
+                 .length = static_cast<uint32_t>(metricId.size())};
+    stringsUsed += static_cast<uint32_t>(metricId.size() + 1);
+    metadataIndexes.emplace(metricId, index);
+    return index;
+}
+
+void ReadingsExport::publish(const Readings& readings)
+{
+    const auto& [timestamp, values] = readings;
+    const size_t count = std::min(values.size(), recordCapacity);
+    auto& h = header();
+
+    const uint64_t sequence = h.sequence.load(std::memory_order_relaxed);
+    h.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (bool reset = false;; reset = true)
+    {
+        bool complete = true;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto& [metricId, value, readingTimestamp] = values[i];
+            const uint32_t index = intern(metricId);
+            complete = complete && index != noMetadata;
+            records()[i] = Record{.metadataIndex = index,
+                                  .reserved = 0,
+                                  .value = value,
+                                  .timestamp = readingTimestamp};
+        }
+
+        if (complete || reset)
+        {
+            break;
+        }
+
+        // Drop ids of metrics that are no longer reported and intern the
+        // current ones again
+        metadataIndexes.clear();
+        stringsUsed = 0;
+    }
+
+    h.timestamp = timestamp;
+    h.recordCount = static_cast<uint32_t>(count);
+    h.readingsCount = static_cast<uint32_t>(
+        std::min<size_t>(values.size(), UINT32_MAX));
+    h.metadataCount = static_cast<uint32_t>(metadataIndexes.size());
+
+    h.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+std::optional<Readings> ReadingsExport::read(std::span<const std::byte> data)
+{
+    if (data.size() < sizeof(Header))
+    {
+        return std::nullopt;
+    }
+
+    const auto& h = *std::launder(reinterpret_cast<const Header*>(data.data()));
+    if (h.magic != magic || h.version != version ||
+        h.recordsOffset + uint64_t{h.recordCapacity} * sizeof(Record) >
+            data.size() ||
+        h.metadataOffset + uint64_t{h.metadataCapacity} * sizeof(Metadata) >
+            data.size() ||
+        h.stringsOffset + uint64_t{h.stringsSize} > data.size())
+    {
+        return std::nullopt;
+    }
+
+    const auto* records =
+        reinterpret_cast<const Record*>(data.data() + h.recordsOffset);
+    const auto* metadata =
+        reinterpret_cast<const Metadata*>(data.data() + h.metadataOffset);
+    const auto* strings =
+        reinterpret_cast<const char*>(data.data() + h.stringsOffset);
+
+    for (size_t attempt = 0; attempt < maxReadAttempts; ++attempt)
+    {
+        const uint64_t sequence = h.sequence.load(std::memory_order_acquire);
+        if (sequence % 2 != 0)
+        {
+            continue;
+        }
+
+        Readings result;
+        auto& [timestamp, values] = result;
+        timestamp = h.timestamp;
+
+        const uint32_t count = std::min(h.recordCount, h.recordCapacity);
+        const uint32_t metadataCount =
+            std::min(h.metadataCount, h.metadataCapacity);
+        values.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const Record record = records[i];
+            std::string_view metricId;
+            if (record.metadataIndex < metadataCount)
+            {
+                const Metadata entry = metadata[record.metadataIndex];
+                if (uint64_t{entry.offset} + entry.length < h.stringsSize)
+                {
+                    metricId = std::string_view(strings + entry.offset,
+                                                entry.length);
+                }
+            }
+            values.emplace_back(std::string(metricId), record.value,
+                                record.timestamp);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (h.sequence.load(std::memory_order_relaxed) == sequence)
+        {
+            return result;
+        }
+    }
+
+    return std::nullopt;
+}
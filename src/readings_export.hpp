@@ -0,0 +1,116 @@
+#pragma once
+
+#include "types/readings.hpp"
+#include "utils/file_descriptor.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+/** Publishes report readings into a sealed memfd for local consumers.
+ *
+ *  The memory starts with a Header followed by a table of Records, a table
+ *  of Metadata entries and a pool of NUL terminated metric ids. Records
+ *  refer to metric ids through Metadata, so ids are only copied into the
+ *  pool the first time they are seen. Writes are guarded by a seqlock, a
+ *  reader samples the sequence, reads the tables in place and retries when
+ *  the sequence is odd or changed in the meantime.
+ *
+ *  The memfd can't be resized and is handed out through a read-only
+ *  descriptor, so consumers can map it but not modify it. Readings beyond
+ *  recordCapacity are not published, readingsCount in the Header tells a
+ *  consumer how many readings the report had. */
+class ReadingsExport
+{
+  public:
+    static constexpr const char* interface =
+        "xyz.openbmc_project.Telemetry.ReadingsExport";
+    static constexpr uint32_t magic = 0x58524c54; // "TLRX"
+    static constexpr uint16_t version = 2;
+    static constexpr uint32_t noMetadata = UINT32_MAX;
+
+    struct Header
+    {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t reserved;
+        std::atomic<uint64_t> sequence;
+        uint64_t timestamp;
+        uint32_t recordCount;
+        /** Readings of the report, above recordCount when some of them
+         *  didn't fit into the records table */
+        uint32_t readingsCount;
+        uint32_t recordCapacity;
+        uint32_t recordsOffset;
+        uint32_t metadataCount;
+        uint32_t metadataCapacity;
+        uint32_t metadataOffset;
+        uint32_t stringsOffset;
+        uint32_t stringsSize;
+    };
+
+    struct Record
+    {
+        /** Index into the Metadata table or noMetadata when the metric id
+         *  didn't fit into the pool */
+        uint32_t metadataIndex;
+        uint32_t reserved;
+        double value;
+        uint64_t timestamp;
+    };
+
+    struct Metadata
+    {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free);
+
+    explicit ReadingsExport(size_t recordCapacity = defaultCapacity());
+    ~ReadingsExport();
+    ReadingsExport(const ReadingsExport&) = delete;
+    ReadingsExport& operator=(const ReadingsExport&) = delete;
+    ReadingsExport(ReadingsExport&&) = delete;
+    ReadingsExport& operator=(ReadingsExport&&) = delete;
+
+    void publish(const Readings& readings);
+
+    /** Read-only descriptor of the memfd, callers should dup it */
+    int getFd() const
+    {
+        return readOnlyFd.get();
+    }
+
+    size_t size() const
+    {
+        return mappingSize;
+    }
+
+    /** Copies a consistent snapshot out of a mapping, returns nullopt when
+     *  the mapping doesn't hold readings or the writer kept it busy */
+    static std::optional<Readings> read(std::span<const std::byte> data);
+
+    static size_t defaultCapacity();
+
+  private:
+    size_t recordCapacity;
+    size_t metadataCapacity;
+    size_t stringsSize;
+    size_t mappingSize;
+    utils::FileDescriptor fd;
+    utils::FileDescriptor readOnlyFd;
+    std::byte* mapping = nullptr;
+    std::unordered_map<std::string, uint32_t> metadataIndexes;
+    uint32_t stringsUsed = 0;
+
+    Header& header();
+    Record* records();
+    Metadata* metadata();
+    char* strings();
+    uint32_t intern(const std::string& metricId);
+};
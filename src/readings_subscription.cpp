@@ -0,0 +1,132 @@
+#include "readings_subscription.hpp"
+
+#include <sdbusplus/bus/match.hpp>
+#include <xyz/openbmc_project/Object/Delete/common.hpp>
+
+#include <utility>
+
+using ObjectDelete = sdbusplus::common::xyz::openbmc_project::object::Delete;
+
+ReadingsSubscription::ReadingsSubscription(
+    const std::shared_ptr<sdbusplus::asio::connection>& bus,
+    const std::shared_ptr<sdbusplus::asio::object_server>& objServerIn,
+    sdbusplus::object_path pathIn, const std::string& clientIn,
+    std::vector<std::string> metricFilterIn, Milliseconds minIntervalIn,
+    std::function<void(ReadingsSubscription&)> removeIn) :
+    objServer(objServerIn), path(std::move(pathIn)), client(clientIn),
+    metricFilter(std::move(metricFilterIn)),
+    filter(metricFilter.begin(), metricFilter.end()),
+    minInterval(minIntervalIn), remove(std::move(removeIn)),
+    timer(bus->get_io_context())
+{
+    subscriptionIface = objServer->add_interface(path.str, interface);
+    subscriptionIface->register_property_r(
+        "Readings", readings, sdbusplus::vtable::property_::emits_change,
+        [this](const auto&) { return readings; });
+    subscriptionIface->register_property_r(
+        "MetricFilter", metricFilter, sdbusplus::vtable::property_::const_,
+        [this](const auto&) { return metricFilter; });
+    subscriptionIface->register_property_r<uint64_t>(
+        "MinInterval", sdbusplus::vtable::property_::const_,
+        [this](const auto&) { return minInterval.count(); });
+    constexpr bool skipPropertiesChangedSignal = true;
+    subscriptionIface->initialize(skipPropertiesChangedSignal);
+
+    deleteIface = objServer->add_interface(path.str, ObjectDelete::interface);
+    deleteIface->register_method(ObjectDelete::method_names::delete_,
+                                 [this] { requestRemoval(); });
+    deleteIface->initialize();
+
+    clientMatch = std::make_unique<sdbusplus::bus::match_t>(
+        *bus, sdbusplus::bus::match::rules::nameOwnerChanged(client),
+        [this](sdbusplus::message_t& message) {
+            std::string name;
+            std::string oldOwner;
+            std::string newOwner;
+            message.read(name, oldOwner, newOwner);
+            if (newOwner.empty())
+            {
+                requestRemoval();
+            }
+        });
+
+    // The client may have left before the match was added
+    bus->async_method_call(
+        [this, weakAlive = std::weak_ptr(alive)](boost::system::error_code ec,
+                                                 bool hasOwner) {
+            if (!ec && !hasOwner && !weakAlive.expired())
+            {
+                requestRemoval();
+            }
+        },
+        "org.freedesktop.DBus", "/org/freedesktop/DBus", "org.freedesktop.DBus",
+        "NameHasOwner", client);
+}
+
+ReadingsSubscription::~ReadingsSubscription()
+{
+    objServer->remove_interface(subscriptionIface);
+    objServer->remove_interface(deleteIface);
+}
+
+void ReadingsSubscription::requestRemoval()
+{
+    if (auto removeOnce = std::exchange(remove, nullptr))
+    {
+        removeOnce(*this);
+    }
+}
+
+void ReadingsSubscription::update(const Readings& newReadings)
+{
+    const auto& [timestamp, values] = newReadings;
+    auto& [filteredTimestamp, filteredValues] = readings;
+
+    filteredTimestamp = timestamp;
+    filteredValues.clear();
+    for (const auto& reading : values)
+    {
+        if (filter.empty() || filter.contains(std::get<0>(reading)))
+        {
+            filteredValues.emplace_back(reading);
+        }
+    }
+
+    if (holdOff)
+    {
+        pending = true;
+        return;
+    }
+
+    emit();
+}
+
+void ReadingsSubscription::emit()
+{
+    subscriptionIface->signal_property("Readings");
+    scheduleHoldOff();
+}
+
+void ReadingsSubscription::scheduleHoldOff()
+{
+    if (minInterval == Milliseconds{0})
+    {
+        return;
+    }
+
+    holdOff = true;
+    timer.expires_after(minInterval);
+    timer.async_wait([this](boost::system::error_code ec) {
+        if (ec)
+        {
+            return;
+        }
+
+        holdOff = false;
+        if (pending)
+        {
+            pending = false;
+            emit();
+        }
+    });
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "types/duration_types.hpp"
+#include "types/readings.hpp"
+
+#include <boost/asio/steady_timer.hpp>
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/asio/object_server.hpp>
+#include <sdbusplus/bus/match.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/** Per client view of report readings.
+ *
+ *  Publishes only readings of metrics matching the filter, an empty filter
+ *  matches every metric. Updates arriving within minInterval of the last
+ *  emitted one are coalesced and the latest of them is emitted once the
+ *  interval passes. The subscription asks to be removed, at most once, when
+ *  its client calls Delete or leaves the bus, including a client which left
+ *  before the subscription started to watch it. */
+class ReadingsSubscription
+{
+  public:
+    static constexpr const char* interface =
+        "xyz.openbmc_project.Telemetry.ReadingsSubscription";
+
+    ReadingsSubscription(
+        const std::shared_ptr<sdbusplus::asio::connection>& bus,
+        const std::shared_ptr<sdbusplus::asio::object_server>& objServer,
+        sdbusplus::object_path path, const std::string& client,
+        std::vector<std::string> metricFilter, Milliseconds minInterval,
+        std::function<void(ReadingsSubscription&)> remove);
+    ~ReadingsSubscription();
+
+    ReadingsSubscription(const ReadingsSubscription&) = delete;
+    ReadingsSubscription& operator=(const ReadingsSubscription&) = delete;
+    ReadingsSubscription(ReadingsSubscription&&) = delete;
+    ReadingsSubscription& operator=(ReadingsSubscription&&) = delete;
+
+    void update(const Readings& readings);
+
+    const sdbusplus::object_path& getPath() const
+    {
+        return path;
+    }
+
+    /** Unique bus name of the subscriber */
+    const std::string& getClient() const
+    {
+        return client;
+    }
+
+  private:
+    std::shared_ptr<sdbusplus::asio::object_server> objServer;
+    const sdbusplus::object_path path;
+    const std::string client;
+    std::vector<std::string> metricFilter;
+    std::unordered_set<std::string> filter;
+    Milliseconds minInterval;
+    std::function<void(ReadingsSubscription&)> remove;
+    Readings readings;
+    boost::asio::steady_timer timer;
+    bool holdOff = false;
+    bool pending = false;
+    std::shared_ptr<sdbusplus::asio::dbus_interface> subscriptionIface;
+    std::shared_ptr<sdbusplus::asio::dbus_interface> deleteIface;
+    std::unique_ptr<sdbusplus::bus::match_t> clientMatch;
+    /** Expires with the subscription, guards replies of pending calls */
+    std::shared_ptr<bool> alive = std::make_shared<bool>(true);
+
+    void requestRemoval();
+    void emit();
+    void scheduleHoldOff();
+};
@@ -1,7 +1,10 @@
 #include "report.hpp"
 
 #include "errors.hpp"
+#include "history/downsample.hpp"
 #include "messages/collect_trigger_id.hpp"
+#include "messages/readings_removed_ind.hpp"
+#include "messages/readings_updated_ind.hpp"
 #include "messages/trigger_presence_changed_ind.hpp"
 #include "messages/update_report_ind.hpp"
 #include "report_manager.hpp"
@@ -9,6 +12,7 @@
 #include "utils/contains.hpp"
 #include "utils/dbus_path_utils.hpp"
 #include "utils/ensure.hpp"
+#include "utils/json_writer.hpp"
 #include "utils/transform.hpp"
 
 #include <phosphor-logging/log.hpp>
@@ -16,9 +20,12 @@
 #include <xyz/openbmc_project/Object/Delete/common.hpp>
 #include <xyz/openbmc_project/Telemetry/Report/common.hpp>
 
+#include <algorithm>
 #include <limits>
 #include <numeric>
 #include <optional>
+#include <span>
+#include <system_error>
 
 using TelemetryReport =
     sdbusplus::common::xyz::openbmc_project::telemetry::Report;
@@ -27,6 +34,7 @@ using ObjectDelete = sdbusplus::common::xyz::openbmc_project::object::Delete;
 
 Report::Report(
     boost::asio::io_context& ioc,
+    const std::shared_ptr<sdbusplus::asio::connection>& bus,
     const std::shared_ptr<sdbusplus::asio::object_server>& objServer,
     const std::string& reportId, const std::string& reportName,
     const ReportingType reportingTypeIn,
@@ -44,10 +52,13 @@ Report::Report(
     reportUpdates(reportUpdatesIn), readings(std::move(readingsIn)),
     readingsBuffer(std::get<1>(readings),
                    deduceBufferSize(reportUpdates, reportingType)),
-    objServer(objServer), metrics(std::move(metricsIn)), timer(ioc),
+    compressReadings(reportFactory.compressReadings()),
+    bus(bus), objServer(objServer), metrics(std::move(metricsIn)), timer(ioc),
     triggerIds(collectTriggerIds(ioc)), reportStorage(reportStorageIn),
     clock(std::move(clock)), messanger(ioc)
 {
+    setReadingBuffer(reportUpdates);
+
     readingParameters =
         toReadingParameters(utils::transform(metrics, [](const auto& metric) {
             return metric->dumpConfiguration();
@@ -72,12 +83,66 @@ Report::Report(
         });
     deleteIface->initialize();
 
+    readingsExportIface =
+        objServer->add_interface(getPath(), ReadingsExport::interface);
+    readingsExportIface->register_method("GetReadingsFd", [this] {
+        if (!readingsExport)
+        {
+            readingsExport = std::make_unique<ReadingsExport>();
+            Readings decoded;
+            readingsExport->publish(currentReadings(decoded));
+        }
+        return sdbusplus::message::unix_fd(readingsExport->getFd());
+    });
+    readingsExportIface->register_method("GetMetricReport", [this] {
+        if (!metricReportRenderer)
+        {
+            metricReportRenderer = std::make_unique<MetricReportRenderer>(id);
+            Readings decoded;
+            metricReportRenderer->render(currentReadings(decoded));
+        }
+        return metricReportRenderer->get();
+    });
+    readingsExportIface->register_method(
+        "Subscribe",
+        [this, &ioc](sdbusplus::message_t& message,
+                     std::vector<std::string> metricFilter,
+                     uint64_t minInterval) {
+            return subscribe(ioc, message.get_sender(),
+                             std::move(metricFilter),
+                             Milliseconds(minInterval));
+        });
+    readingsExportIface->register_method(
+        "GetReadings",
+        [this](uint64_t start, uint64_t end, uint64_t maxPoints) {
+            return getReadings(start, end, maxPoints);
+        });
+    readingsExportIface->register_method(
+        "GetRollup", [this](uint64_t resolution, uint64_t start, uint64_t end) {
+            return getRollup(resolution, start, end);
+        });
+    readingsExportIface->register_property_r<std::vector<uint8_t>>(
+        "ReadingsPacked", sdbusplus::vtable::property_::emits_change,
+        [this](const auto&) {
+            if (!readingsPacker)
+            {
+                readingsPacker = std::make_unique<utils::ReadingsPacker>();
+                Readings decoded;
+                readingsPacker->pack(currentReadings(decoded));
+            }
+            return readingsPacker->get();
+        });
+    constexpr bool skipPropertiesChangedSignal = true;
+    readingsExportIface->initialize(skipPropertiesChangedSignal);
+
     auto errorMessages = verify(reportingType, interval);
     state.set<ReportFlags::enabled, ReportFlags::valid>(enabledIn,
                                                         errorMessages.empty());
 
     reportIface = makeReportInterface(reportFactory);
     persistency = storeConfiguration();
+    readingsHistory = reportFactory.makeHistory(id);
+    readingsRollup = reportFactory.makeRollup();
 
     messanger.on_receive<messages::TriggerPresenceChangedInd>(
         [this](const auto& msg) {
@@ -118,6 +183,9 @@ Report::~Report()
 {
     objServer->remove_interface(reportIface);
     objServer->remove_interface(deleteIface);
+    objServer->remove_interface(readingsExportIface);
+
+    messanger.send(messages::ReadingsRemovedInd{id});
 
     if (persistency)
     {
@@ -129,6 +197,10 @@ Report::~Report()
     else
     {
         reportStorage.remove(reportFileName());
+        if (readingsHistory)
+        {
+            readingsHistory->remove();
+        }
     }
 }
 
@@ -151,6 +223,8 @@ void Report::deactivate()
 
     unregisterFromMetrics = nullptr;
     timer.cancel();
+
+    messanger.send(messages::ReadingsRemovedInd{id});
 }
 
 uint64_t Report::getMetricCount(
@@ -182,12 +256,73 @@ void Report::setReadingBuffer(const ReportUpdates newReportUpdates)
 {
     const auto newBufferSize =
         deduceBufferSize(newReportUpdates, reportingType);
-    if (readingsBuffer.size() != newBufferSize)
+    const bool compress =
+        shouldCompressReadings(newReportUpdates, reportingType);
+
+    if (compress && !compressedReadings)
+    {
+        compressedReadings =
+            std::make_unique<utils::CompressedReadings>(newBufferSize);
+        if (readingsBuffer.size() == newBufferSize)
+        {
+            for (const auto& [metricId, value, timestamp] : readingsBuffer)
+            {
+                compressedReadings->emplace(metricId, value, timestamp);
+            }
+        }
+        readingsBuffer.clearAndResize(0);
+    }
+    else if (!compress && compressedReadings)
+    {
+        readingsBuffer.clearAndResize(newBufferSize);
+        if (compressedReadings->size() == newBufferSize)
+        {
+            for (auto& [metricId, value, timestamp] :
+                 compressedReadings->decode())
+            {
+                readingsBuffer.emplace(std::move(metricId), value, timestamp);
+            }
+        }
+        compressedReadings = nullptr;
+    }
+    else if (compressedReadings)
+    {
+        if (compressedReadings->size() != newBufferSize)
+        {
+            compressedReadings->clearAndResize(newBufferSize);
+        }
+    }
+    else if (readingsBuffer.size() != newBufferSize)
     {
         readingsBuffer.clearAndResize(newBufferSize);
     }
 }
 
+bool Report::shouldCompressReadings(const ReportUpdates reportUpdatesIn,
+                                    const ReportingType reportingTypeIn) const
+{
+    return compressReadings && reportUpdatesIn != ReportUpdates::overwrite &&
+           reportingTypeIn != ReportingType::onRequest;
+}
+
+const Readings& Report::currentReadings(Readings& decoded) const
+{
+    if (!compressedReadings)
+    {
+        return readings;
+    }
+
+    decoded = Readings{std::get<0>(readings), compressedReadings->decode()};
+    return decoded;
+}
+
+bool Report::hasReadingsConsumers() const
+{
+    return readingsExport || metricReportRenderer || readingsPacker ||
+           !subscriptions.empty() ||
+           messanger.has_receivers<messages::ReadingsUpdatedInd>();
+}
+
 void Report::setReportUpdates(const ReportUpdates newReportUpdates)
 {
     if (reportUpdates != newReportUpdates)
@@ -296,7 +431,10 @@ std::shared_ptr<sdbusplus::asio::dbus_interface> Report::makeReportInterface(
     dbusIface->register_property_r(
         TelemetryReport::property_names::readings, readings,
         sdbusplus::vtable::property_::emits_change,
-        [this](const auto&) { return readings; });
+        [this](const auto&) {
+            Readings decoded;
+            return currentReadings(decoded);
+        });
     dbusIface->register_property_r<std::string>(
         TelemetryReport::property_names::reporting_type,
         sdbusplus::vtable::property_::emits_change,
@@ -470,6 +608,9 @@ void Report::updateReadings()
         readingsBuffer.clear();
     }
 
+    const CollectionTimestamp collectionTimestamp{
+        .steady = clock->steadyTimestamp(), .system = clock->systemTimestamp()};
+
     for (const auto& metric : metrics)
     {
         if (!state.isActive())
@@ -478,28 +619,120 @@ void Report::updateReadings()
         }
 
         for (const auto& [metadata, value, timestamp] :
-             metric->getUpdatedReadings())
+             metric->getUpdatedReadings(collectionTimestamp))
         {
             if (reportUpdates == ReportUpdates::appendStopsWhenFull &&
-                readingsBuffer.isFull())
+                (compressedReadings ? compressedReadings->isFull()
+                                    : readingsBuffer.isFull()))
             {
                 state.set<ReportFlags::enabled>(false);
                 reportIface->signal_property(
                     TelemetryReport::property_names::enabled);
                 break;
             }
-            readingsBuffer.emplace(metadata, value, timestamp);
+            if (compressedReadings)
+            {
+                compressedReadings->emplace(metadata, value, timestamp);
+            }
+            else
+            {
+                readingsBuffer.emplace(metadata, value, timestamp);
+            }
+            if (readingsHistory)
+            {
+                readingsHistory->append(metadata, value, timestamp);
+            }
+            if (readingsRollup)
+            {
+                readingsRollup->add(metadata, value, timestamp);
+            }
         }
     }
 
-    std::get<0>(readings) =
-        std::chrono::duration_cast<Milliseconds>(clock->systemTimestamp())
-            .count();
+    if (readingsHistory)
+    {
+        readingsHistory->tick();
+    }
+
+    std::get<0>(readings) = collectionTimestamp.system.count();
+
+    // Compressed readings are decoded only when something consumes them
+    Readings decoded;
+    const Readings& current =
+        hasReadingsConsumers() ? currentReadings(decoded) : readings;
+
+    if (readingsExport)
+    {
+        readingsExport->publish(current);
+    }
+    if (metricReportRenderer)
+    {
+        metricReportRenderer->render(current);
+    }
+    if (readingsPacker)
+    {
+        readingsPacker->pack(current);
+    }
+
+    for (const auto& subscription : subscriptions)
+    {
+        subscription->update(current);
+    }
+
+    messanger.send(messages::ReadingsUpdatedInd{id, current});
 
     if (utils::contains(reportActions, ReportAction::emitsReadingsUpdate))
     {
         reportIface->signal_property(TelemetryReport::property_names::readings);
+        if (readingsPacker)
+        {
+            readingsExportIface->signal_property("ReadingsPacked");
+        }
+    }
+}
+
+sdbusplus::object_path Report::subscribe(boost::asio::io_context& ioc,
+                                         const std::string& client,
+                                         std::vector<std::string> metricFilter,
+                                         Milliseconds minInterval)
+{
+    const auto clientSubscriptions =
+        std::ranges::count_if(subscriptions, [&client](const auto& item) {
+            return item->getClient() == client;
+        });
+    if (static_cast<size_t>(clientSubscriptions) >= maxSubscriptions)
+    {
+        throw sdbusplus::exception::SdBusError(
+            static_cast<int>(std::errc::too_many_files_open),
+            "Reached maximal subscription count of the client");
     }
+
+    auto& subscription =
+        subscriptions.emplace_back(std::make_unique<ReadingsSubscription>(
+            bus, objServer,
+            utils::pathAppend(path, "Subscriptions/" +
+                                        std::to_string(nextSubscriptionId++)),
+            client, std::move(metricFilter), minInterval,
+            [this, &ioc](ReadingsSubscription& removed) {
+                auto it = std::ranges::find_if(
+                    subscriptions, [&removed](const auto& item) {
+                        return item.get() == &removed;
+                    });
+                if (it == subscriptions.end())
+                {
+                    return;
+                }
+
+                // Removal is requested from the subscription's own D-Bus
+                // handlers, it is destroyed once they return. The posted
+                // handler owns it, so it does not depend on this report.
+                boost::asio::post(ioc, [subscription = std::move(*it)] {});
+                subscriptions.erase(it);
+            }));
+    Readings decoded;
+    subscription->update(currentReadings(decoded));
+
+    return subscription->getPath();
 }
 
 bool Report::shouldStoreMetricValues() const
@@ -512,31 +745,37 @@ bool Report::storeConfiguration() const
 {
     try
     {
-        nlohmann::json data;
-
-        data["Enabled"] = state.get<ReportFlags::enabled>();
-        data["Version"] = reportVersion;
-        data["Id"] = id;
-        data["Name"] = name;
-        data["ReportingType"] = utils::toUnderlying(reportingType);
-        data["ReportActions"] =
-            utils::transform(reportActions, [](const auto reportAction) {
-                return utils::toUnderlying(reportAction);
-            });
-        data["Interval"] = interval.count();
-        data["AppendLimit"] = appendLimit;
-        data["ReportUpdates"] = utils::toUnderlying(reportUpdates);
-        data["ReadingParameters"] =
-            utils::transform(metrics, [](const auto& metric) {
-                return metric->dumpConfiguration();
-            });
-
+        std::string data;
+        data.reserve(storedConfigurationSize);
+        utils::JsonWriter json(data);
+
+        json.beginObject();
+        json.member("AppendLimit", appendLimit);
+        json.member("Enabled", state.get<ReportFlags::enabled>());
+        json.member("Id", id);
+        json.member("Interval", interval.count());
         if (shouldStoreMetricValues())
         {
-            data["MetricValues"] = utils::toLabeledReadings(readings);
+            json.key("MetricValues");
+            Readings decoded;
+            utils::writeLabeledReadings(json, currentReadings(decoded));
         }
-
-        reportStorage.store(reportFileName(), data);
+        json.member("Name", name);
+        json.key("ReadingParameters");
+        json.beginArray();
+        for (const auto& metric : metrics)
+        {
+            json.write(metric->dumpConfiguration());
+        }
+        json.endArray();
+        json.member("ReportActions", reportActions);
+        json.member("ReportUpdates", reportUpdates);
+        json.member("ReportingType", reportingType);
+        json.member("Version", reportVersion);
+        json.endObject();
+
+        reportStorage.storeSerialized(reportFileName(), data);
+        storedConfigurationSize = data.size();
     }
     catch (const std::exception& e)
     {
@@ -636,6 +875,77 @@ void Report::scheduleTimer()
     }
 }
 
+std::vector<ReadingData> Report::getReadings(uint64_t start, uint64_t end,
+                                             uint64_t maxPoints) const
+{
+    if (start > end)
+    {
+        throw errors::InvalidArgument("End");
+    }
+    if (maxPoints == 0)
+    {
+        throw errors::InvalidArgument("MaxPoints");
+    }
+
+    history::Downsampler downsampler(
+        std::min<uint64_t>(maxPoints, maxReadingsPoints));
+    const auto add = [&downsampler](const ReadingData& reading) {
+        const auto& [metricId, value, timestamp] = reading;
+        downsampler.add(metricId, value, timestamp);
+    };
+
+    if (readingsHistory)
+    {
+        readingsHistory->read(start, end,
+                              [&add](std::span<const ReadingData> readings) {
+                                  std::ranges::for_each(readings, add);
+                              });
+        return downsampler.finish();
+    }
+
+    Readings decoded;
+    std::vector<const ReadingData*> inRange;
+    for (const auto& reading : std::get<1>(currentReadings(decoded)))
+    {
+        const auto timestamp = std::get<2>(reading);
+        if (timestamp >= start && timestamp <= end)
+        {
+            inRange.emplace_back(&reading);
+        }
+    }
+
+    // Append buffers are kept in storage order, which is not time order once
+    // they wrap, while the downsampler needs each metric in time order
+    std::ranges::stable_sort(inRange, {}, [](const ReadingData* reading) {
+        return std::get<2>(*reading);
+    });
+    for (const auto* reading : inRange)
+    {
+        add(*reading);
+    }
+    return downsampler.finish();
+}
+
+std::vector<history::RollupReading> Report::getRollup(uint64_t resolution,
+                                                     uint64_t start,
+                                                     uint64_t end) const
+{
+    if (start > end)
+    {
+        throw errors::InvalidArgument("End");
+    }
+
+    if (readingsRollup)
+    {
+        if (auto result =
+                readingsRollup->read(Milliseconds(resolution), start, end))
+        {
+            return std::move(*result);
+        }
+    }
+    throw errors::InvalidArgument("Resolution");
+}
+
 std::vector<ErrorMessage> Report::verify(ReportingType reportingType,
                                          Milliseconds interval)
 {
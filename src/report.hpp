@@ -7,6 +7,9 @@
 #include "interfaces/report.hpp"
 #include "interfaces/report_factory.hpp"
 #include "interfaces/report_manager.hpp"
+#include "metric_report_renderer.hpp"
+#include "readings_export.hpp"
+#include "readings_subscription.hpp"
 #include "state.hpp"
 #include "types/error_message.hpp"
 #include "types/readings.hpp"
@@ -15,9 +18,11 @@
 #include "types/report_updates.hpp"
 #include "types/reporting_type.hpp"
 #include "utils/circular_vector.hpp"
+#include "utils/compressed_readings.hpp"
 #include "utils/dbus_path_utils.hpp"
 #include "utils/ensure.hpp"
 #include "utils/messanger.hpp"
+#include "utils/readings_packer.hpp"
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/steady_timer.hpp>
@@ -58,6 +63,7 @@ class Report : public interfaces::Report, public interfaces::MetricListener
 
   public:
     Report(boost::asio::io_context& ioc,
+           const std::shared_ptr<sdbusplus::asio::connection>& bus,
            const std::shared_ptr<sdbusplus::asio::object_server>& objServer,
            const std::string& reportId, const std::string& reportName,
            const ReportingType reportingType,
@@ -102,6 +108,10 @@ class Report : public interfaces::Report, public interfaces::MetricListener
     uint64_t deduceBufferSize(const ReportUpdates reportUpdatesIn,
                               const ReportingType reportingTypeIn) const;
     void setReadingBuffer(const ReportUpdates newReportUpdates);
+    bool shouldCompressReadings(const ReportUpdates reportUpdatesIn,
+                                const ReportingType reportingTypeIn) const;
+    const Readings& currentReadings(Readings& decoded) const;
+    bool hasReadingsConsumers() const;
     void setReportUpdates(const ReportUpdates newReportUpdates);
     static uint64_t getMetricCount(
         const std::vector<std::shared_ptr<interfaces::Metric>>& metrics);
@@ -112,6 +122,15 @@ class Report : public interfaces::Report, public interfaces::MetricListener
     bool shouldStoreMetricValues() const;
     void updateReadings();
     void scheduleTimer();
+    sdbusplus::object_path subscribe(boost::asio::io_context& ioc,
+                                     const std::string& client,
+                                     std::vector<std::string> metricFilter,
+                                     Milliseconds minInterval);
+    std::vector<ReadingData> getReadings(uint64_t start, uint64_t end,
+                                         uint64_t maxPoints) const;
+    std::vector<history::RollupReading> getRollup(uint64_t resolution,
+                                                  uint64_t start,
+                                                  uint64_t end) const;
     static std::vector<ErrorMessage> verify(ReportingType, Milliseconds);
 
     std::string id;
@@ -122,14 +141,33 @@ class Report : public interfaces::Report, public interfaces::MetricListener
     std::unordered_set<ReportAction> reportActions;
     ReadingParameters readingParameters;
     bool persistency = false;
+    mutable size_t storedConfigurationSize = 0;
     uint64_t metricCount;
     uint64_t appendLimit;
     ReportUpdates reportUpdates;
     Readings readings = {};
     CircularVector<ReadingData> readingsBuffer;
+    bool compressReadings;
+    /** Replaces readingsBuffer for append reports when compressReadings is
+     *  set */
+    std::unique_ptr<utils::CompressedReadings> compressedReadings;
+    std::shared_ptr<sdbusplus::asio::connection> bus;
     std::shared_ptr<sdbusplus::asio::object_server> objServer;
     std::shared_ptr<sdbusplus::asio::dbus_interface> reportIface;
     std::shared_ptr<sdbusplus::asio::dbus_interface> deleteIface;
+    std::shared_ptr<sdbusplus::asio::dbus_interface> readingsExportIface;
+    /** Created on the first GetReadingsFd call */
+    std::unique_ptr<ReadingsExport> readingsExport;
+    /** Created on the first GetMetricReport call */
+    std::unique_ptr<MetricReportRenderer> metricReportRenderer;
+    /** Created on the first ReadingsPacked read */
+    std::unique_ptr<utils::ReadingsPacker> readingsPacker;
+    std::vector<std::unique_ptr<ReadingsSubscription>> subscriptions;
+    /** Set only when report history is enabled in the build */
+    std::unique_ptr<history::Store> readingsHistory;
+    /** Set only when report rollups are enabled in the build */
+    std::unique_ptr<history::Rollup> readingsRollup;
+    uint64_t nextSubscriptionId = 0;
     std::vector<std::shared_ptr<interfaces::Metric>> metrics;
     boost::asio::steady_timer timer;
     std::unordered_set<std::string> triggerIds;
@@ -144,4 +182,8 @@ class Report : public interfaces::Report, public interfaces::MetricListener
 
   public:
     static constexpr size_t reportVersion = 7;
+    /** Limit of subscriptions of a single client to this report */
+    static constexpr size_t maxSubscriptions = 16;
+    /** Larger MaxPoints of GetReadings are reduced to it */
+    static constexpr size_t maxReadingsPoints = 4096;
 };
@@ -1,18 +1,39 @@
 #include "report_factory.hpp"
 
+#include "hwmon_sensor.hpp"
 #include "metric.hpp"
 #include "report.hpp"
 #include "sensor.hpp"
 #include "utils/clock.hpp"
 #include "utils/conversion.hpp"
-#include "utils/dbus_mapper.hpp"
 #include "utils/transform.hpp"
 
+#include <phosphor-logging/log.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <unordered_set>
+
+namespace
+{
+
+const std::filesystem::path historyDirectory = "/var/lib/telemetry/History";
+
+std::string historyName(const std::string& reportId)
+{
+    return std::to_string(std::hash<std::string>{}(reportId));
+}
+
+} // namespace
+
 ReportFactory::ReportFactory(
     std::shared_ptr<sdbusplus::asio::connection> bus,
     const std::shared_ptr<sdbusplus::asio::object_server>& objServer,
-    SensorCache& sensorCache) :
-    bus(std::move(bus)), objServer(objServer), sensorCache(sensorCache)
+    SensorCache& sensorCache, SensorDirectory& sensorDirectory,
+    HwmonScheduler& hwmonScheduler, SamplingScheduler& samplingScheduler) :
+    bus(std::move(bus)), objServer(objServer), sensorCache(sensorCache),
+    sensorDirectory(sensorDirectory), hwmonScheduler(hwmonScheduler),
+    samplingScheduler(samplingScheduler)
 {}
 
 std::unique_ptr<interfaces::Report> ReportFactory::make(
@@ -35,17 +56,97 @@ std::unique_ptr<interfaces::Report> ReportFactory::make(
                 getSensors(param.at_label<ts::SensorPath>()),
                 param.at_label<ts::OperationType>(),
                 param.at_label<ts::CollectionTimeScope>(),
-                param.at_label<ts::CollectionDuration>(),
-                std::make_unique<Clock>());
+                param.at_label<ts::CollectionDuration>());
         });
 
     return std::make_unique<Report>(
-        bus->get_io_context(), objServer, id, name, reportingType,
+        bus->get_io_context(), bus, objServer, id, name, reportingType,
         reportActions, period, appendLimit, reportUpdates, reportManager,
         reportStorage, std::move(metrics), *this, enabled,
         std::make_unique<Clock>(), std::move(readings));
 }
 
+std::unique_ptr<history::Store>
+    ReportFactory::makeHistory(const std::string& id) const
+{
+    if (historySize == 0)
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        return std::make_unique<history::Store>(
+            historyDirectory / historyName(id),
+            history::Store::Limits{
+                .maxSize = historySize,
+                .maxAge = historyMaxAge,
+                .segmentSize = std::max<uint64_t>(historySize / 8, 1),
+                .flushTicks = historyFlushTicks});
+    }
+    catch (const std::exception& e)
+    {
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "Failed to open report history",
+            phosphor::logging::entry("REPORT_ID=%s", id.c_str()),
+            phosphor::logging::entry("EXCEPTION_MSG=%s", e.what()));
+        return nullptr;
+    }
+}
+
+void ReportFactory::removeStaleHistory(
+    const std::vector<std::string>& reportIds) const
+{
+    std::unordered_set<std::string> names;
+    for (const auto& id : reportIds)
+    {
+        names.emplace(historyName(id));
+    }
+
+    try
+    {
+        if (!std::filesystem::is_directory(historyDirectory))
+        {
+            return;
+        }
+
+        std::vector<std::filesystem::path> stale;
+        for (const auto& entry :
+             std::filesystem::directory_iterator(historyDirectory))
+        {
+            if (!names.contains(entry.path().filename().string()))
+            {
+                stale.emplace_back(entry.path());
+            }
+        }
+
+        for (const auto& path : stale)
+        {
+            std::filesystem::remove_all(path);
+        }
+    }
+    catch (const std::filesystem::filesystem_error& e)
+    {
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "Failed to remove stale report history",
+            phosphor::logging::entry("EXCEPTION_MSG=%s", e.what()));
+    }
+}
+
+std::unique_ptr<history::Rollup> ReportFactory::makeRollup() const
+{
+    using namespace std::chrono_literals;
+
+    if (!rollupsEnabled)
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<history::Rollup>(std::vector<history::Rollup::Tier>{
+        {.resolution = 1min, .retention = 6h},
+        {.resolution = 1h, .retention = 7 * 24h}});
+}
+
 void ReportFactory::updateMetrics(
     std::vector<std::shared_ptr<interfaces::Metric>>& metrics, bool enabled,
     const std::vector<LabeledMetricParameters>& labeledMetricParams) const
@@ -73,8 +174,7 @@ void ReportFactory::updateMetrics(
             getSensors(labeledMetricParam.at_label<ts::SensorPath>()),
             labeledMetricParam.at_label<ts::OperationType>(),
             labeledMetricParam.at_label<ts::CollectionTimeScope>(),
-            labeledMetricParam.at_label<ts::CollectionDuration>(),
-            std::make_unique<Clock>()));
+            labeledMetricParam.at_label<ts::CollectionDuration>()));
 
         if (enabled)
         {
@@ -102,9 +202,16 @@ Sensors ReportFactory::getSensors(
         sensorPaths,
         [this](const LabeledSensorInfo& sensorPath)
             -> std::shared_ptr<interfaces::Sensor> {
+            if (sensorPath.at_label<Service>() == HwmonScheduler::service)
+            {
+                return sensorCache.makeSensor<HwmonSensor>(
+                    sensorPath.at_label<Service>(), sensorPath.at_label<Path>(),
+                    sensorPath.at_label<Metadata>(), hwmonScheduler);
+            }
             return sensorCache.makeSensor<Sensor>(
                 sensorPath.at_label<Service>(), sensorPath.at_label<Path>(),
-                sensorPath.at_label<Metadata>(), bus->get_io_context(), bus);
+                sensorPath.at_label<Metadata>(), bus->get_io_context(), bus,
+                &samplingScheduler);
         });
 }
 
@@ -117,8 +224,11 @@ std::vector<LabeledMetricParameters> ReportFactory::convertMetricParams(
         return {};
     }
 
-    auto tree = utils::getSubTreeSensors(yield, bus);
-    return getMetricParamsFromSensorTree(metricParams, tree);
+    if (!isInSensorDirectory(metricParams))
+    {
+        sensorDirectory.refresh(yield);
+    }
+    return getMetricParamsFromSensorDirectory(metricParams);
 }
 
 std::vector<LabeledMetricParameters> ReportFactory::convertMetricParams(
@@ -129,18 +239,46 @@ std::vector<LabeledMetricParameters> ReportFactory::convertMetricParams(
         return {};
     }
 
-    auto tree = utils::getSubTreeSensors(bus);
-    return getMetricParamsFromSensorTree(metricParams, tree);
+    // Used from property setters which cannot yield, only sensors missing
+    // from the directory are looked up
+    if (!isInSensorDirectory(metricParams))
+    {
+        std::vector<std::string> paths;
+        for (const auto& item : metricParams)
+        {
+            for (const auto& [sensorPath, metadata] : std::get<0>(item))
+            {
+                if (!HwmonScheduler::isHwmonPath(sensorPath.str))
+                {
+                    paths.emplace_back(sensorPath.str);
+                }
+            }
+        }
+        sensorDirectory.resolve(paths);
+    }
+    return getMetricParamsFromSensorDirectory(metricParams);
+}
+
+bool ReportFactory::isInSensorDirectory(
+    const ReadingParameters& metricParams) const
+{
+    return std::ranges::all_of(metricParams, [this](const auto& item) {
+        return std::ranges::all_of(
+            std::get<0>(item), [this](const auto& sensorPath) {
+                const auto& path = std::get<0>(sensorPath).str;
+                return HwmonScheduler::isHwmonPath(path) ||
+                       sensorDirectory.find(path) != nullptr;
+            });
+    });
 }
 
 std::vector<LabeledMetricParameters>
-    ReportFactory::getMetricParamsFromSensorTree(
-        const ReadingParameters& metricParams,
-        const std::vector<utils::SensorTree>& tree) const
+    ReportFactory::getMetricParamsFromSensorDirectory(
+        const ReadingParameters& metricParams) const
 {
     try
     {
-        return utils::transform(metricParams, [&tree](const auto& item) {
+        return utils::transform(metricParams, [this](const auto& item) {
             auto [sensorPaths, operationType, collectionTimeScope,
                   collectionDuration] = item;
 
@@ -148,16 +286,23 @@ std::vector<LabeledMetricParameters>
 
             for (const auto& [sensorPath, metadata] : sensorPaths)
             {
-                auto it = std::find_if(tree.begin(), tree.end(),
-                                       [path = sensorPath](const auto& v) {
-                                           return v.first == path;
-                                       });
+                if (HwmonScheduler::isHwmonPath(sensorPath.str))
+                {
+                    if (hwmonScheduler.isReadable(sensorPath.str))
+                    {
+                        sensorParameters.emplace_back(
+                            std::string(HwmonScheduler::service), sensorPath,
+                            metadata);
+                    }
+                    continue;
+                }
+
+                const auto* services = sensorDirectory.find(sensorPath.str);
 
-                if (it != tree.end() && it->second.size() == 1)
+                if (services && services->size() == 1)
                 {
-                    const auto& [service, ifaces] = it->second.front();
-                    sensorParameters.emplace_back(service, sensorPath,
-                                                  metadata);
+                    sensorParameters.emplace_back(services->front(),
+                                                  sensorPath, metadata);
                 }
             }
 
@@ -1,10 +1,12 @@
 #pragma once
 
+#include "hwmon_scheduler.hpp"
 #include "interfaces/report_factory.hpp"
 #include "interfaces/sensor.hpp"
+#include "sampling_scheduler.hpp"
 #include "sensor_cache.hpp"
+#include "sensor_directory.hpp"
 #include "types/sensor_types.hpp"
-#include "utils/dbus_mapper.hpp"
 
 #include <boost/asio/io_context.hpp>
 #include <sdbusplus/asio/object_server.hpp>
@@ -15,7 +17,8 @@ class ReportFactory : public interfaces::ReportFactory
     ReportFactory(
         std::shared_ptr<sdbusplus::asio::connection> bus,
         const std::shared_ptr<sdbusplus::asio::object_server>& objServer,
-        SensorCache& sensorCache);
+        SensorCache& sensorCache, SensorDirectory& sensorDirectory,
+        HwmonScheduler& hwmonScheduler, SamplingScheduler& samplingScheduler);
 
     std::vector<LabeledMetricParameters> convertMetricParams(
         boost::asio::yield_context& yield,
@@ -39,13 +42,37 @@ class ReportFactory : public interfaces::ReportFactory
         std::vector<LabeledMetricParameters> labeledMetricParams, bool enabled,
         Readings) const override;
 
+    std::unique_ptr<history::Store> makeHistory(
+        const std::string& id) const override;
+    void removeStaleHistory(
+        const std::vector<std::string>& reportIds) const override;
+
+    std::unique_ptr<history::Rollup> makeRollup() const override;
+
+    bool compressReadings() const override
+    {
+        return readingsCompressionEnabled;
+    }
+
   private:
     Sensors getSensors(const std::vector<LabeledSensorInfo>& sensorPaths) const;
-    std::vector<LabeledMetricParameters> getMetricParamsFromSensorTree(
-        const ReadingParameters& metricParams,
-        const std::vector<utils::SensorTree>& tree) const;
+    bool isInSensorDirectory(const ReadingParameters& metricParams) const;
+    std::vector<LabeledMetricParameters> getMetricParamsFromSensorDirectory(
+        const ReadingParameters& metricParams) const;
 
     std::shared_ptr<sdbusplus::asio::connection> bus;
     std::shared_ptr<sdbusplus::asio::object_server> objServer;
     SensorCache& sensorCache;
+    SensorDirectory& sensorDirectory;
+    HwmonScheduler& hwmonScheduler;
+    SamplingScheduler& samplingScheduler;
+
+    static constexpr uint64_t historySize{TELEMETRY_REPORT_HISTORY_SIZE};
+    static constexpr Milliseconds historyMaxAge{
+        std::chrono::seconds(TELEMETRY_REPORT_HISTORY_MAX_AGE)};
+    static constexpr uint64_t historyFlushTicks{
+        TELEMETRY_REPORT_HISTORY_FLUSH_TICKS};
+    static constexpr bool rollupsEnabled{TELEMETRY_REPORT_ROLLUPS};
+    static constexpr bool readingsCompressionEnabled{
+        TELEMETRY_COMPRESSED_READINGS};
 };
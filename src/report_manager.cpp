@@ -4,6 +4,7 @@
 #include "types/report_types.hpp"
 #include "utils/conversion.hpp"
 #include "utils/dbus_path_utils.hpp"
+#include "utils/json_reader.hpp"
 #include "utils/make_id_name.hpp"
 #include "utils/transform.hpp"
 
@@ -189,51 +190,102 @@ void ReportManager::loadFromPersistent()
 
     for (const auto& path : paths)
     {
-        std::optional<nlohmann::json> data = reportStorage->load(path);
+        std::optional<std::string> data = reportStorage->loadSerialized(path);
 
         if (!data)
         {
             reportStorage->remove(path);
             continue;
         }
-        const auto& j = *data;
 
         try
         {
-            size_t version = j.at("Version").get<size_t>();
-            if (version != Report::reportVersion)
+            std::optional<size_t> version;
+            std::optional<bool> enabled;
+            std::optional<std::string> id;
+            std::optional<std::string> name;
+            std::optional<uint32_t> reportingType;
+            std::optional<std::vector<uint32_t>> reportActions;
+            std::optional<uint64_t> interval;
+            std::optional<uint64_t> appendLimit;
+            std::optional<uint32_t> reportUpdates;
+            std::optional<std::vector<LabeledMetricParameters>>
+                readingParameters;
+            Readings readings = {};
+
+            utils::JsonReader json(*data);
+            std::string_view key;
+
+            json.beginObject();
+            while (json.nextKey(key))
             {
-                throw std::logic_error("Invalid version");
+                if (key == "Version")
+                {
+                    version = json.read<size_t>();
+                }
+                else if (key == "Enabled")
+                {
+                    enabled = json.read<bool>();
+                }
+                else if (key == "Id")
+                {
+                    id = json.read<std::string>();
+                }
+                else if (key == "Name")
+                {
+                    name = json.read<std::string>();
+                }
+                else if (key == "ReportingType")
+                {
+                    reportingType = json.read<uint32_t>();
+                }
+                else if (key == "ReportActions")
+                {
+                    reportActions = json.read<std::vector<uint32_t>>();
+                }
+                else if (key == "Interval")
+                {
+                    interval = json.read<uint64_t>();
+                }
+                else if (key == "AppendLimit")
+                {
+                    appendLimit = json.read<uint64_t>();
+                }
+                else if (key == "ReportUpdates")
+                {
+                    reportUpdates = json.read<uint32_t>();
+                }
+                else if (key == "ReadingParameters")
+                {
+                    readingParameters =
+                        json.read<std::vector<LabeledMetricParameters>>();
+                }
+                else if (key == "MetricValues")
+                {
+                    readings = utils::readLabeledReadings(json);
+                }
+                else
+                {
+                    json.skipValue();
+                }
             }
-            bool enabled = j.at("Enabled").get<bool>();
-            const std::string& id = j.at("Id").get_ref<const std::string&>();
-            const std::string& name =
-                j.at("Name").get_ref<const std::string&>();
-            uint32_t reportingType = j.at("ReportingType").get<uint32_t>();
-            std::vector<ReportAction> reportActions = utils::transform(
-                j.at("ReportActions").get<std::vector<uint32_t>>(),
-                [](const auto reportAction) {
-                    return utils::toReportAction(reportAction);
-                });
-            uint64_t interval = j.at("Interval").get<uint64_t>();
-            uint64_t appendLimit = j.at("AppendLimit").get<uint64_t>();
-            uint32_t reportUpdates = j.at("ReportUpdates").get<uint32_t>();
-            auto readingParameters =
-                j.at("ReadingParameters")
-                    .get<std::vector<LabeledMetricParameters>>();
+            json.end();
 
-            Readings readings = {};
-
-            if (auto it = j.find("MetricValues"); it != j.end())
+            if (version.value() != Report::reportVersion)
             {
-                const auto labeledReadings = it->get<LabeledReadings>();
-                readings = utils::toReadings(labeledReadings);
+                throw std::logic_error("Invalid version");
             }
 
-            addReport(id, name, utils::toReportingType(reportingType),
-                      reportActions, Milliseconds(interval), appendLimit,
-                      utils::toReportUpdates(reportUpdates),
-                      std::move(readingParameters), enabled,
+            addReport(id.value(), name.value(),
+                      utils::toReportingType(reportingType.value()),
+                      utils::transform(reportActions.value(),
+                                       [](const auto reportAction) {
+                                           return utils::toReportAction(
+                                               reportAction);
+                                       }),
+                      Milliseconds(interval.value()), appendLimit.value(),
+                      utils::toReportUpdates(reportUpdates.value()),
+                      std::move(readingParameters.value()), enabled.value(),
                       std::move(readings));
         }
         catch (const std::exception& e)
@@ -247,6 +299,9 @@ void ReportManager::loadFromPersistent()
             reportStorage->remove(path);
         }
     }
+
+    reportFactory->removeStaleHistory(utils::transform(
+        reports, [](const auto& report) { return report->getId(); }));
 }
 
 void ReportManager::verifyMetricParams(
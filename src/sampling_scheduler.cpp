@@ -0,0 +1,268 @@
+#include "sampling_scheduler.hpp"
+
+#include "sensor.hpp"
+#include "utils/clock.hpp"
+
+#include <boost/container/flat_map.hpp>
+#include <nlohmann/json.hpp>
+#include <phosphor-logging/log.hpp>
+#include <systemd/sd-bus.h>
+#include <xyz/openbmc_project/Sensor/Value/common.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+using SensorValue = sdbusplus::common::xyz::openbmc_project::sensor::Value;
+
+namespace
+{
+
+using ValueVariant = std::variant<std::monostate, double>;
+using PropertyMap = boost::container::flat_map<std::string, ValueVariant>;
+using InterfaceMap = boost::container::flat_map<std::string, PropertyMap>;
+using ManagedObjects =
+    boost::container::flat_map<sdbusplus::message::object_path, InterfaceMap>;
+
+const double* findValue(const PropertyMap& properties)
+{
+    auto it = properties.find(SensorValue::property_names::value);
+    if (it == properties.end())
+    {
+        return nullptr;
+    }
+    return std::get_if<double>(&it->second);
+}
+
+} // namespace
+
+SamplingScheduler::SamplingScheduler(
+    std::shared_ptr<sdbusplus::asio::connection> bus, Policies policies) :
+    bus(std::move(bus)), policies(std::move(policies))
+{}
+
+SamplingScheduler::Policies
+    SamplingScheduler::loadPolicies(const std::filesystem::path& file)
+{
+    Policies result;
+
+    std::ifstream stream(file);
+    if (!stream)
+    {
+        return result;
+    }
+
+    try
+    {
+        for (const auto& item : nlohmann::json::parse(stream))
+        {
+            auto path = item.at("Path").get<std::string>();
+            auto policy = SamplingPolicy{
+                .mode = utils::toSamplingMode(
+                    item.at("Mode").get<std::string>()),
+                .interval = Milliseconds(item.value("Interval", uint64_t{0}))};
+
+            if (policy.mode != SamplingMode::signal &&
+                policy.interval == Milliseconds{0})
+            {
+                phosphor::logging::log<phosphor::logging::level::ERR>(
+                    "Sampling policy without interval ignored",
+                    phosphor::logging::entry("SENSOR_PATH=%s", path.c_str()));
+                continue;
+            }
+
+            result.emplace_back(std::move(path), policy);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "Failed to load sampling policies",
+            phosphor::logging::entry("FILE=%s", file.c_str()),
+            phosphor::logging::entry("EXCEPTION_MSG=%s", e.what()));
+        return {};
+    }
+
+    return result;
+}
+
+SamplingPolicy SamplingScheduler::policyFor(std::string_view path) const
+{
+    const std::pair<std::string, SamplingPolicy>* best = nullptr;
+
+    for (const auto& item : policies)
+    {
+        const auto& [policyPath, policy] = item;
+        if (policyPath == path)
+        {
+            return policy;
+        }
+        if (policyPath.ends_with('/') && path.starts_with(policyPath) &&
+            (!best || best->first.size() < policyPath.size()))
+        {
+            best = &item;
+        }
+    }
+
+    return best ? best->second : SamplingPolicy{};
+}
+
+void SamplingScheduler::subscribe(const std::shared_ptr<Sensor>& sensor,
+                                  Milliseconds interval)
+{
+    auto& group =
+        groups.try_emplace(interval, bus->get_io_context()).first->second;
+    group.services[sensor->id().service()].emplace_back(
+        Subscription{.key = sensor.get(), .sensor = sensor});
+
+    schedule(interval, group);
+}
+
+void SamplingScheduler::unsubscribe(const Sensor& sensor)
+{
+    for (auto& [interval, group] : groups)
+    {
+        for (auto& [service, subscriptions] : group.services)
+        {
+            std::erase_if(subscriptions, [&sensor](const auto& subscription) {
+                return subscription.key == &sensor;
+            });
+        }
+        std::erase_if(group.services,
+                      [](const auto& item) { return item.second.empty(); });
+    }
+}
+
+void SamplingScheduler::schedule(Milliseconds interval, Group& group)
+{
+    if (group.scheduled)
+    {
+        return;
+    }
+
+    group.scheduled = true;
+    group.timer.expires_after(interval);
+    group.timer.async_wait(
+        [this, interval, &group](boost::system::error_code ec) {
+            if (ec)
+            {
+                return;
+            }
+
+            group.scheduled = false;
+            poll(group);
+
+            if (!group.services.empty())
+            {
+                schedule(interval, group);
+            }
+        });
+}
+
+void SamplingScheduler::poll(Group& group)
+{
+    for (auto& [service, subscriptions] : group.services)
+    {
+        std::erase_if(subscriptions, [](const auto& subscription) {
+            return subscription.sensor.expired();
+        });
+
+        if (servicesWithoutObjectManager.contains(service))
+        {
+            pollEach(service, subscriptions);
+        }
+        else
+        {
+            pollManagedObjects(service, subscriptions);
+        }
+    }
+    std::erase_if(group.services,
+                  [](const auto& item) { return item.second.empty(); });
+}
+
+bool SamplingScheduler::isObjectManagerMissing(std::string_view errorName)
+{
+    return errorName == SD_BUS_ERROR_UNKNOWN_METHOD ||
+           errorName == SD_BUS_ERROR_UNKNOWN_INTERFACE ||
+           errorName == SD_BUS_ERROR_UNKNOWN_OBJECT;
+}
+
+void SamplingScheduler::pollManagedObjects(const std::string& service,
+                                           Subscriptions subscriptions)
+{
+    bus->async_method_call(
+        [this, service, subscriptions = std::move(subscriptions)](
+            boost::system::error_code ec, sdbusplus::message_t& reply,
+            const ManagedObjects& objects) {
+            if (ec)
+            {
+                const sd_bus_error* error = reply.get_error();
+                if (error != nullptr && error->name != nullptr &&
+                    isObjectManagerMissing(error->name))
+                {
+                    servicesWithoutObjectManager.insert(service);
+                    pollEach(service, subscriptions);
+                }
+                return;
+            }
+
+            const auto timestamp = Clock().steadyTimestamp();
+            for (const auto& subscription : subscriptions)
+            {
+                auto sensor = subscription.sensor.lock();
+                if (!sensor)
+                {
+                    continue;
+                }
+
+                auto object = objects.find(
+                    sdbusplus::message::object_path(sensor->id().path()));
+                if (object == objects.end())
+                {
+                    continue;
+                }
+
+                auto iface = object->second.find(SensorValue::interface);
+                if (iface == object->second.end())
+                {
+                    continue;
+                }
+
+                if (const auto* value = findValue(iface->second))
+                {
+                    sensor->updateValue(*value, timestamp);
+                }
+            }
+        },
+        service, SensorValue::namespace_path::value,
+        "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+}
+
+void SamplingScheduler::pollEach(const std::string& service,
+                                 const Subscriptions& subscriptions)
+{
+    for (const auto& subscription : subscriptions)
+    {
+        auto sensor = subscription.sensor.lock();
+        if (!sensor)
+        {
+            continue;
+        }
+
+        bus->async_method_call(
+            [weakSensor = subscription.sensor](boost::system::error_code ec,
+                                               const PropertyMap& properties) {
+                auto sensor = weakSensor.lock();
+                if (ec || !sensor)
+                {
+                    return;
+                }
+
+                if (const auto* value = findValue(properties))
+                {
+                    sensor->updateValue(*value, Clock().steadyTimestamp());
+                }
+            },
+            service, sensor->id().path(), "org.freedesktop.DBus.Properties",
+            "GetAll", SensorValue::interface);
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "types/duration_types.hpp"
+#include "types/sampling_mode.hpp"
+
+#include <boost/asio/steady_timer.hpp>
+#include <sdbusplus/asio/connection.hpp>
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+class Sensor;
+
+/** Holds per sensor sampling policies and polls the sensors that are not
+ * driven by PropertiesChanged signals.
+ *
+ * Polled sensors sharing an interval are read on one timer. Each tick issues
+ * a single GetManagedObjects per service, services without an ObjectManager
+ * on the sensors namespace are read with GetAll per sensor instead. Any
+ * other GetManagedObjects failure only skips the tick for that service.
+ */
+class SamplingScheduler
+{
+  public:
+    using Policies = std::vector<std::pair<std::string, SamplingPolicy>>;
+
+    SamplingScheduler(std::shared_ptr<sdbusplus::asio::connection> bus,
+                      Policies policies);
+
+    SamplingScheduler(const SamplingScheduler&) = delete;
+    SamplingScheduler& operator=(const SamplingScheduler&) = delete;
+
+    /** Reads policies from a JSON array of objects with "Path", "Mode" and
+     * "Interval" keys. A path ending with '/' applies to every sensor below
+     * it. A missing file yields no policies.
+     */
+    static Policies loadPolicies(const std::filesystem::path& file);
+
+    SamplingPolicy policyFor(std::string_view path) const;
+
+    /** Tells whether a GetManagedObjects error means the service has no
+     * ObjectManager on the sensors namespace.
+     */
+    static bool isObjectManagerMissing(std::string_view errorName);
+
+    void subscribe(const std::shared_ptr<Sensor>& sensor,
+                   Milliseconds interval);
+    void unsubscribe(const Sensor& sensor);
+
+  private:
+    struct Subscription
+    {
+        const Sensor* key;
+        std::weak_ptr<Sensor> sensor;
+    };
+
+    using Subscriptions = std::vector<Subscription>;
+
+    struct Group
+    {
+        explicit Group(boost::asio::io_context& ioc) : timer(ioc) {}
+
+        boost::asio::steady_timer timer;
+        std::unordered_map<std::string, Subscriptions> services;
+        bool scheduled = false;
+    };
+
+    void schedule(Milliseconds interval, Group& group);
+    void poll(Group& group);
+    void pollManagedObjects(const std::string& service,
+                            Subscriptions subscriptions);
+    void pollEach(const std::string& service,
+                  const Subscriptions& subscriptions);
+
+    std::shared_ptr<sdbusplus::asio::connection> bus;
+    Policies policies;
+    std::map<Milliseconds, Group> groups;
+    std::unordered_set<std::string> servicesWithoutObjectManager;
+};
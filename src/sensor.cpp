@@ -1,8 +1,9 @@
 #include "sensor.hpp"
 
+#include "sampling_scheduler.hpp"
 #include "utils/clock.hpp"
+#include "utils/properties_changed.hpp"
 
-#include <boost/container/flat_map.hpp>
 #include <phosphor-logging/log.hpp>
 #include <sdbusplus/asio/property.hpp>
 #include <xyz/openbmc_project/Sensor/Value/common.hpp>
@@ -13,11 +14,23 @@ using SensorValue = sdbusplus::common::xyz::openbmc_project::sensor::Value;
 
 Sensor::Sensor(interfaces::Sensor::Id sensorId,
                const std::string& sensorMetadata, boost::asio::io_context& ioc,
-               const std::shared_ptr<sdbusplus::asio::connection>& bus) :
+               const std::shared_ptr<sdbusplus::asio::connection>& bus,
+               SamplingScheduler* samplingScheduler) :
     sensorId(std::move(sensorId)), sensorMetadata(sensorMetadata), ioc(ioc),
-    bus(bus)
+    bus(bus), samplingScheduler(samplingScheduler),
+    policy(samplingScheduler
+               ? samplingScheduler->policyFor(this->sensorId.path())
+               : SamplingPolicy{})
 {}
 
+Sensor::~Sensor()
+{
+    if (polled)
+    {
+        samplingScheduler->unsubscribe(*this);
+    }
+}
+
 Sensor::Id Sensor::makeId(std::string_view service, std::string_view path)
 {
     return Id("Sensor", service, path);
@@ -35,7 +48,7 @@ std::string Sensor::metadata() const
 
 std::string Sensor::getName() const
 {
-    return sensorMetadata.empty() ? sensorId.path : sensorMetadata;
+    return sensorMetadata.empty() ? sensorId.path() : sensorMetadata;
 }
 
 void Sensor::async_read()
@@ -45,10 +58,17 @@ void Sensor::async_read()
 
 void Sensor::async_read(std::shared_ptr<utils::UniqueCall::Lock> lock)
 {
-    makeSignalMonitor();
+    if (policy.mode == SamplingMode::poll)
+    {
+        subscribeForPolling();
+    }
+    else
+    {
+        makeSignalMonitor();
+    }
 
     sdbusplus::asio::getProperty<double>(
-        *bus, sensorId.service, sensorId.path, SensorValue::interface,
+        *bus, sensorId.service(), sensorId.path(), SensorValue::interface,
         SensorValue::property_names::value,
         [lock, id = sensorId, weakSelf = weak_from_this()](
             boost::system::error_code ec, double newValue) {
@@ -56,13 +76,14 @@ void Sensor::async_read(std::shared_ptr<utils::UniqueCall::Lock> lock)
             {
                 phosphor::logging::log<phosphor::logging::level::WARNING>(
                     "DBus 'GetProperty' call failed on Sensor Value",
-                    phosphor::logging::entry("SENSOR_PATH=%s", id.path.c_str()),
+                    phosphor::logging::entry("SENSOR_PATH=%s",
+                                             id.path().c_str()),
                     phosphor::logging::entry("ERROR_CODE=%d", ec.value()));
                 return;
             }
             if (auto self = weakSelf.lock())
             {
-                self->updateValue(newValue);
+                self->updateValue(newValue, Clock().steadyTimestamp());
             }
         });
 }
@@ -106,9 +127,9 @@ void Sensor::unregisterFromUpdates(
     }
 }
 
-void Sensor::updateValue(double newValue)
+void Sensor::updateValue(double newValue, Milliseconds newTimestamp)
 {
-    timestamp = Clock().steadyTimestamp();
+    timestamp = newTimestamp;
 
     if (value != newValue)
     {
@@ -134,7 +155,7 @@ void Sensor::makeSignalMonitor()
     using namespace std::string_literals;
 
     const auto param =
-        "type='signal',member='PropertiesChanged',path='"s + sensorId.path +
+        "type='signal',member='PropertiesChanged',path='"s + sensorId.path() +
         "',arg0='" + SensorValue::interface + "'"s;
 
     signalMonitor = std::make_unique<sdbusplus::match>(
@@ -149,37 +170,84 @@ void Sensor::signalProc(const std::weak_ptr<Sensor>& weakSelf,
 {
     if (auto self = weakSelf.lock())
     {
-        std::string iface;
-        boost::container::flat_map<std::string, ValueVariant>
-            changed_properties;
-        std::vector<std::string> invalidated_properties;
+        const auto changed = utils::readChangedProperty(
+            message, SensorValue::interface,
+            SensorValue::property_names::value);
+        if (changed.value)
+        {
+            self->signalUpdate(*changed.value, Clock().steadyTimestamp());
+        }
+        else if (changed.found)
+        {
+            phosphor::logging::log<phosphor::logging::level::ERR>(
+                "Failed to receive Value from Sensor "
+                "PropertiesChanged signal",
+                phosphor::logging::entry("SENSOR_PATH=%s",
+                                         self->sensorId.path().c_str()));
+        }
+    }
+}
+
+void Sensor::subscribeForPolling()
+{
+    if (polled || !samplingScheduler)
+    {
+        return;
+    }
 
-        message.read(iface, changed_properties, invalidated_properties);
+    polled = true;
+    samplingScheduler->subscribe(shared_from_this(), policy.interval);
+}
 
-        if (iface == SensorValue::interface)
-        {
-            const auto it =
-                changed_properties.find(SensorValue::property_names::value);
-            if (it != changed_properties.end())
+void Sensor::signalUpdate(double newValue, Milliseconds newTimestamp)
+{
+    if (policy.mode != SamplingMode::signalRateLimited)
+    {
+        updateValue(newValue, newTimestamp);
+        return;
+    }
+
+    // Only the latest value is kept while waiting for the rate limit window
+    // to pass, intermediate signals are dropped.
+    const bool flushScheduled = pendingUpdate.has_value();
+    pendingUpdate = std::make_pair(newValue, newTimestamp);
+    if (flushScheduled)
+    {
+        return;
+    }
+
+    const auto now = Clock().steadyTimestamp();
+    if (now >= lastSignalUpdate + policy.interval)
+    {
+        flushSignalUpdate();
+        return;
+    }
+
+    if (!timer)
+    {
+        timer.emplace(ioc);
+    }
+    timer->expires_after(lastSignalUpdate + policy.interval - now);
+    timer->async_wait(
+        [weakSelf = weak_from_this()](boost::system::error_code ec) {
+            if (auto self = weakSelf.lock(); self && !ec)
             {
-                if (auto val = std::get_if<double>(&it->second))
-                {
-                    self->updateValue(*val);
-                }
-                else
-                {
-                    phosphor::logging::log<phosphor::logging::level::ERR>(
-                        "Failed to receive Value from Sensor "
-                        "PropertiesChanged signal",
-                        phosphor::logging::entry("SENSOR_PATH=%s",
-                                                 self->sensorId.path.c_str()));
-                }
+                self->flushSignalUpdate();
             }
-        }
-    }
+        });
+}
+
+void Sensor::flushSignalUpdate()
+{
+    lastSignalUpdate = Clock().steadyTimestamp();
+
+    const auto [newValue, newTimestamp] = *pendingUpdate;
+    pendingUpdate = std::nullopt;
+    updateValue(newValue, newTimestamp);
 }
 
 LabeledSensorInfo Sensor::getLabeledSensorInfo() const
 {
-    return LabeledSensorInfo(sensorId.service, sensorId.path, sensorMetadata);
+    return LabeledSensorInfo(sensorId.service(), sensorId.path(),
+                             sensorMetadata);
 }
@@ -3,6 +3,7 @@
 #include "interfaces/sensor.hpp"
 #include "interfaces/sensor_listener.hpp"
 #include "types/duration_types.hpp"
+#include "types/sampling_mode.hpp"
 #include "utils/unique_call.hpp"
 
 #include <boost/asio/high_resolution_timer.hpp>
@@ -10,6 +11,10 @@
 #include <sdbusplus/bus/match.hpp>
 
 #include <memory>
+#include <optional>
+#include <utility>
+
+class SamplingScheduler;
 
 class Sensor final :
     public interfaces::Sensor,
@@ -20,9 +25,10 @@ class Sensor final :
   public:
     Sensor(interfaces::Sensor::Id sensorId, const std::string& sensorMetadata,
            boost::asio::io_context& ioc,
-           const std::shared_ptr<sdbusplus::asio::connection>& bus);
+           const std::shared_ptr<sdbusplus::asio::connection>& bus,
+           SamplingScheduler* samplingScheduler = nullptr);
 
-    ~Sensor() = default;
+    ~Sensor();
     Sensor(const Sensor&) = delete;
     Sensor& operator=(const Sensor&) = delete;
     Sensor(Sensor&&) = delete;
@@ -40,6 +46,8 @@ class Sensor final :
 
     LabeledSensorInfo getLabeledSensorInfo() const override;
 
+    void updateValue(double, Milliseconds);
+
   private:
     static std::optional<double> readValue(const ValueVariant& v);
     static void signalProc(const std::weak_ptr<Sensor>& weakSelf,
@@ -48,7 +56,9 @@ class Sensor final :
     void async_read();
     void async_read(std::shared_ptr<utils::UniqueCall::Lock>);
     void makeSignalMonitor();
-    void updateValue(double);
+    void subscribeForPolling();
+    void signalUpdate(double, Milliseconds);
+    void flushSignalUpdate();
 
     interfaces::Sensor::Id sensorId;
     std::string sensorMetadata;
@@ -62,4 +72,10 @@ class Sensor final :
     Milliseconds timestamp = Milliseconds{0u};
     std::optional<double> value;
     std::unique_ptr<sdbusplus::match> signalMonitor;
+
+    SamplingScheduler* samplingScheduler;
+    SamplingPolicy policy;
+    bool polled = false;
+    Milliseconds lastSignalUpdate = Milliseconds{0u};
+    std::optional<std::pair<double, Milliseconds>> pendingUpdate;
 };
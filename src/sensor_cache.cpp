@@ -1,20 +1,18 @@
 #include "sensor_cache.hpp"
 
-SensorCache::SensorsContainer::iterator SensorCache::findExpiredSensor(
-    SensorCache::SensorsContainer::iterator begin)
-{
-    return std::find_if(begin, sensors.end(), [](const auto& item) {
-        return item.second.expired();
-    });
-}
+#include <algorithm>
 
 void SensorCache::cleanupExpiredSensors()
 {
-    auto begin = sensors.begin();
-
-    for (auto it = findExpiredSensor(begin); it != sensors.end();
-         it = findExpiredSensor(begin))
+    // Expired sensors are removed only when the cache doubles in size since
+    // the previous cleanup, which keeps insertion amortized O(1).
+    if (sensors.size() < cleanupThreshold)
     {
-        begin = sensors.erase(it);
+        return;
     }
+
+    std::erase_if(sensors,
+                  [](const auto& item) { return item.second.expired(); });
+
+    cleanupThreshold = std::max(minCleanupThreshold, 2 * sensors.size());
 }
@@ -2,11 +2,11 @@
 
 #include "interfaces/sensor.hpp"
 
-#include <boost/container/flat_map.hpp>
 #include <boost/system/error_code.hpp>
 
 #include <memory>
 #include <string_view>
+#include <unordered_map>
 
 class SensorCache
 {
@@ -15,31 +15,37 @@ class SensorCache
     std::shared_ptr<SensorType> makeSensor(
         std::string_view service, std::string_view path, Args&&... args)
     {
-        cleanupExpiredSensors();
-
         auto id = SensorType::makeId(service, path);
-        auto it = sensors.find(id);
 
-        if (it == sensors.end())
+        if (auto it = sensors.find(id); it != sensors.end())
         {
-            auto sensor = std::make_shared<SensorType>(
-                std::move(id), std::forward<Args>(args)...);
+            if (auto sensor = it->second.lock())
+            {
+                return std::static_pointer_cast<SensorType>(sensor);
+            }
+            sensors.erase(it);
+        }
 
-            sensors[sensor->id()] = sensor;
+        cleanupExpiredSensors();
 
-            return sensor;
-        }
+        auto sensor =
+            std::make_shared<SensorType>(id, std::forward<Args>(args)...);
+
+        sensors.emplace(std::move(id), sensor);
 
-        return std::static_pointer_cast<SensorType>(it->second.lock());
+        return sensor;
     }
 
   private:
     using SensorsContainer =
-        boost::container::flat_map<interfaces::Sensor::Id,
-                                   std::weak_ptr<interfaces::Sensor>>;
+        std::unordered_map<interfaces::Sensor::Id,
+                           std::weak_ptr<interfaces::Sensor>,
+                           interfaces::Sensor::Id::Hash>;
+
+    static constexpr size_t minCleanupThreshold = 64;
 
     SensorsContainer sensors;
+    size_t cleanupThreshold = minCleanupThreshold;
 
-    SensorsContainer::iterator findExpiredSensor(SensorsContainer::iterator);
     void cleanupExpiredSensors();
 };
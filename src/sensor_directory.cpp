@@ -0,0 +1,310 @@
+#include "sensor_directory.hpp"
+
+#include "utils/contains.hpp"
+
+#include <boost/container/flat_map.hpp>
+#include <phosphor-logging/log.hpp>
+#include <sdbusplus/exception.hpp>
+
+#include <algorithm>
+
+namespace
+{
+
+std::string makeMatch(std::string_view member)
+{
+    using namespace std::string_literals;
+
+    return "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+           "member='"s +
+           std::string(member) + "',arg0path='" +
+           utils::SensorValue::namespace_path::value + "/'";
+}
+
+} // namespace
+
+SensorDirectory::SensorDirectory(
+    std::shared_ptr<sdbusplus::asio::connection> busIn) : bus(std::move(busIn))
+{
+    interfacesAddedMatch = std::make_unique<sdbusplus::bus::match_t>(
+        *bus, makeMatch("InterfacesAdded"),
+        [this](sdbusplus::message_t& message) { interfacesAdded(message); });
+    interfacesRemovedMatch = std::make_unique<sdbusplus::bus::match_t>(
+        *bus, makeMatch("InterfacesRemoved"),
+        [this](sdbusplus::message_t& message) { interfacesRemoved(message); });
+    nameOwnerChangedMatch = std::make_unique<sdbusplus::bus::match_t>(
+        *bus, sdbusplus::bus::match::rules::nameOwnerChanged(),
+        [this](sdbusplus::message_t& message) { nameOwnerChanged(message); });
+
+    scheduleRefresh();
+}
+
+const std::vector<std::string>* SensorDirectory::find(
+    const std::string& path) const
+{
+    if (auto it = services.find(path); it != services.end())
+    {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+void SensorDirectory::refresh(boost::asio::yield_context& yield)
+{
+    update(utils::getSubTreeSensors(yield, bus));
+}
+
+void SensorDirectory::resolve(const std::vector<std::string>& paths)
+{
+    for (const auto& path : paths)
+    {
+        if (find(path))
+        {
+            continue;
+        }
+
+        try
+        {
+            for (const auto& [service, ifaces] :
+                 utils::getObjectSensor(bus, path))
+            {
+                add(path, service);
+            }
+        }
+        catch (const sdbusplus::exception_t&)
+        {
+            // Unknown sensor, rejected by the caller
+        }
+    }
+}
+
+void SensorDirectory::update(const std::vector<utils::SensorTree>& tree)
+{
+    services.clear();
+    services.reserve(tree.size());
+    owners.clear();
+
+    for (const auto& [path, serviceIfaces] : tree)
+    {
+        auto& entry = services[path];
+        for (const auto& [service, ifaces] : serviceIfaces)
+        {
+            entry.emplace_back(service);
+            watch(service);
+        }
+    }
+}
+
+void SensorDirectory::add(const std::string& path, const std::string& service)
+{
+    auto& entry = services[path];
+    if (!utils::contains(entry, service))
+    {
+        entry.emplace_back(service);
+        watch(service);
+    }
+}
+
+void SensorDirectory::remove(const std::string& path,
+                             const std::string& service)
+{
+    if (auto it = services.find(path); it != services.end())
+    {
+        if (std::erase(it->second, service) > 0)
+        {
+            unwatch(service);
+        }
+        if (it->second.empty())
+        {
+            services.erase(it);
+        }
+    }
+}
+
+void SensorDirectory::removeService(const std::string& service)
+{
+    std::erase_if(services, [&service](auto& entry) {
+        std::erase(entry.second, service);
+        return entry.second.empty();
+    });
+    owners.erase(service);
+}
+
+void SensorDirectory::watch(const std::string& service)
+{
+    auto [it, inserted] = owners.try_emplace(service);
+    ++it->second.sensors;
+    if (!inserted)
+    {
+        return;
+    }
+
+    if (service.starts_with(':'))
+    {
+        it->second.uniqueName = service;
+        return;
+    }
+
+    bus->async_method_call(
+        [this, weakAlive = std::weak_ptr(alive),
+         service](boost::system::error_code ec, const std::string& uniqueName) {
+            if (ec || weakAlive.expired())
+            {
+                return;
+            }
+            if (auto found = owners.find(service); found != owners.end())
+            {
+                found->second.uniqueName = uniqueName;
+            }
+        },
+        "org.freedesktop.DBus", "/org/freedesktop/DBus", "org.freedesktop.DBus",
+        "GetNameOwner", service);
+}
+
+void SensorDirectory::unwatch(const std::string& service)
+{
+    if (auto it = owners.find(service);
+        it != owners.end() && --it->second.sensors == 0)
+    {
+        owners.erase(it);
+    }
+}
+
+void SensorDirectory::nameOwnerChanged(sdbusplus::message_t& message)
+{
+    std::string name;
+    std::string oldOwner;
+    std::string newOwner;
+    message.read(name, oldOwner, newOwner);
+
+    auto it = owners.find(name);
+    if (it == owners.end())
+    {
+        return;
+    }
+
+    // A service which left the bus, e.g. crashed, does not send
+    // InterfacesRemoved for its sensors
+    if (newOwner.empty())
+    {
+        removeService(name);
+        return;
+    }
+    it->second.uniqueName = std::move(newOwner);
+}
+
+void SensorDirectory::scheduleRefresh()
+{
+    uniqueCall([this](auto lock) {
+        bus->async_method_call(
+            [this, lock, weakAlive = std::weak_ptr(alive)](
+                boost::system::error_code ec,
+                const std::vector<utils::SensorTree>& tree) {
+                if (weakAlive.expired())
+                {
+                    return;
+                }
+                if (ec)
+                {
+                    phosphor::logging::log<phosphor::logging::level::WARNING>(
+                        "Failed to refresh sensor directory",
+                        phosphor::logging::entry("ERROR_CODE=%d", ec.value()));
+                    return;
+                }
+
+                // Merge, sensors may already have been added by signals.
+                for (const auto& [path, serviceIfaces] : tree)
+                {
+                    for (const auto& [service, ifaces] : serviceIfaces)
+                    {
+                        add(path, service);
+                    }
+                }
+            },
+            utils::ObjectMapper::default_service,
+            utils::ObjectMapper::instance_path, utils::ObjectMapper::interface,
+            utils::ObjectMapper::method_names::get_sub_tree,
+            utils::SensorValue::namespace_path::value, 2,
+            utils::sensorInterfaces);
+    });
+}
+
+void SensorDirectory::interfacesAdded(sdbusplus::message_t& message)
+{
+    sdbusplus::message::object_path path;
+    boost::container::flat_map<
+        std::string,
+        boost::container::flat_map<std::string, std::variant<std::monostate>>>
+        interfaces;
+    message.read(path, interfaces);
+
+    if (!utils::contains(interfaces, utils::SensorValue::interface))
+    {
+        return;
+    }
+
+    // Signal sender is a unique name, ask the mapper for the well-known name
+    // which is what reports and triggers store in their configuration.
+    bus->async_method_call(
+        [this, weakAlive = std::weak_ptr(alive), path = path.str](
+            boost::system::error_code ec,
+            const std::vector<std::pair<std::string, utils::Ifaces>>&
+                serviceIfaces) {
+            if (ec || weakAlive.expired())
+            {
+                return;
+            }
+            for (const auto& [service, ifaces] : serviceIfaces)
+            {
+                add(path, service);
+            }
+        },
+        utils::ObjectMapper::default_service,
+        utils::ObjectMapper::instance_path, utils::ObjectMapper::interface,
+        utils::ObjectMapper::method_names::get_object, path.str,
+        utils::sensorInterfaces);
+}
+
+void SensorDirectory::interfacesRemoved(sdbusplus::message_t& message)
+{
+    sdbusplus::message::object_path path;
+    std::vector<std::string> interfaces;
+    message.read(path, interfaces);
+
+    auto it = services.find(path.str);
+    if (it == services.end() ||
+        !utils::contains(interfaces, utils::SensorValue::interface))
+    {
+        return;
+    }
+
+    // Signal sender is a unique name, other services may still host the
+    // sensor under the same path
+    const std::string sender = message.get_sender();
+    const auto hostedBySender = [this, &sender](const std::string& service) {
+        if (service == sender)
+        {
+            return true;
+        }
+        const auto owner = owners.find(service);
+        return owner != owners.end() && owner->second.uniqueName == sender;
+    };
+
+    auto& hosts = it->second;
+    for (auto service = hosts.begin(); service != hosts.end();)
+    {
+        if (hostedBySender(*service))
+        {
+            unwatch(*service);
+            service = hosts.erase(service);
+        }
+        else
+        {
+            ++service;
+        }
+    }
+    if (hosts.empty())
+    {
+        services.erase(it);
+    }
+}
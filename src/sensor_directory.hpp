@@ -0,0 +1,71 @@
+#pragma once
+
+#include "utils/dbus_mapper.hpp"
+#include "utils/unique_call.hpp"
+
+#include <boost/asio/spawn.hpp>
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/bus/match.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/** Maps sensor paths to the services that host them.
+ *
+ * The directory is populated with one ObjectMapper GetSubTree call and kept
+ * current with InterfacesAdded/InterfacesRemoved signals, so resolving the
+ * sensors of a report or trigger does not need a mapper round trip. A single
+ * NameOwnerChanged match follows the owners of cached services, so the
+ * sensors of a service which left the bus without InterfacesRemoved are
+ * dropped too.
+ */
+class SensorDirectory
+{
+  public:
+    explicit SensorDirectory(std::shared_ptr<sdbusplus::asio::connection> bus);
+
+    SensorDirectory(const SensorDirectory&) = delete;
+    SensorDirectory& operator=(const SensorDirectory&) = delete;
+
+    const std::vector<std::string>* find(const std::string& path) const;
+
+    void refresh(boost::asio::yield_context& yield);
+    void scheduleRefresh();
+
+    /** Looks up paths missing from the directory with one ObjectMapper
+     *  GetObject call each, for callers which cannot yield, e.g. property
+     *  setters running before the initial refresh completed */
+    void resolve(const std::vector<std::string>& paths);
+
+    void update(const std::vector<utils::SensorTree>& tree);
+    void add(const std::string& path, const std::string& service);
+    void remove(const std::string& path, const std::string& service);
+    void removeService(const std::string& service);
+
+  private:
+    /** Unique name currently owning a cached service, kept while the
+     *  service hosts any cached sensor */
+    struct ServiceOwner
+    {
+        std::string uniqueName;
+        size_t sensors = 0;
+    };
+
+    void watch(const std::string& service);
+    void unwatch(const std::string& service);
+    void nameOwnerChanged(sdbusplus::message_t& message);
+    void interfacesAdded(sdbusplus::message_t& message);
+    void interfacesRemoved(sdbusplus::message_t& message);
+
+    std::shared_ptr<sdbusplus::asio::connection> bus;
+    std::unordered_map<std::string, std::vector<std::string>> services;
+    std::unordered_map<std::string, ServiceOwner> owners;
+    /** Expires with the directory, guards replies of pending calls */
+    std::shared_ptr<bool> alive = std::make_shared<bool>(true);
+    std::unique_ptr<sdbusplus::bus::match_t> interfacesAddedMatch;
+    std::unique_ptr<sdbusplus::bus::match_t> interfacesRemovedMatch;
+    std::unique_ptr<sdbusplus::bus::match_t> nameOwnerChangedMatch;
+    utils::UniqueCall uniqueCall;
+};
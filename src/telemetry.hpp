@@ -1,14 +1,21 @@
 #pragma once
 
+#include "hwmon_scheduler.hpp"
+#include "open_metrics_exporter.hpp"
 #include "persistent_json_storage.hpp"
 #include "report_factory.hpp"
 #include "report_manager.hpp"
+#include "sampling_scheduler.hpp"
 #include "sensor_cache.hpp"
+#include "sensor_directory.hpp"
 #include "trigger_factory.hpp"
 #include "trigger_manager.hpp"
+#include "utils/dbus_path_utils.hpp"
 
+#include <phosphor-logging/log.hpp>
 #include <sdbusplus/asio/connection.hpp>
 #include <sdbusplus/asio/object_server.hpp>
+#include <sdbusplus/server/manager.hpp>
 
 #include <memory>
 
@@ -17,14 +24,24 @@ class Telemetry
   public:
     explicit Telemetry(std::shared_ptr<sdbusplus::asio::connection> bus) :
         objServer(std::make_shared<sdbusplus::asio::object_server>(bus)),
-        reportManager(
-            std::make_unique<ReportFactory>(bus, objServer, sensorCache),
+        objManager(*bus, utils::constants::telemetryPath),
+        sensorDirectory(bus),
+        hwmonScheduler(bus->get_io_context(),
+                       Milliseconds(TELEMETRY_HWMON_POLL_INTERVAL)),
+        samplingScheduler(bus, SamplingScheduler::loadPolicies(
+                                   TELEMETRY_SAMPLING_POLICY_FILE)),
+        openMetricsExporter(makeOpenMetricsExporter(bus->get_io_context())),
+        reportManager(std::make_unique<ReportFactory>(
+                          bus, objServer, sensorCache, sensorDirectory,
+                          hwmonScheduler, samplingScheduler),
             std::make_unique<PersistentJsonStorage>(
                 interfaces::JsonStorage::DirectoryPath(
                     "/var/lib/telemetry/Reports")),
             objServer),
         triggerManager(
-            std::make_unique<TriggerFactory>(bus, objServer, sensorCache),
+            std::make_unique<TriggerFactory>(bus, objServer, sensorCache,
+                                             sensorDirectory,
+                                             samplingScheduler),
             std::make_unique<PersistentJsonStorage>(
                 interfaces::JsonStorage::DirectoryPath(
                     "/var/lib/telemetry/Triggers")),
@@ -32,8 +49,37 @@ class Telemetry
     {}
 
   private:
+    static std::unique_ptr<OpenMetricsExporter>
+        makeOpenMetricsExporter(boost::asio::io_context& ioc)
+    {
+        constexpr std::string_view socketPath = TELEMETRY_OPENMETRICS_SOCKET;
+        if (socketPath.empty())
+        {
+            return nullptr;
+        }
+
+        try
+        {
+            return std::make_unique<OpenMetricsExporter>(ioc, socketPath);
+        }
+        catch (const std::exception& e)
+        {
+            phosphor::logging::log<phosphor::logging::level::ERR>(
+                "Failed to start OpenMetrics exporter",
+                phosphor::logging::entry("EXCEPTION_MSG=%s", e.what()));
+            return nullptr;
+        }
+    }
+
     std::shared_ptr<sdbusplus::asio::object_server> objServer;
+    /** Lets clients fetch every report and trigger with a single
+     *  GetManagedObjects and follow InterfacesAdded/InterfacesRemoved. */
+    sdbusplus::server::manager_t objManager;
     mutable SensorCache sensorCache;
+    SensorDirectory sensorDirectory;
+    HwmonScheduler hwmonScheduler;
+    SamplingScheduler samplingScheduler;
+    std::unique_ptr<OpenMetricsExporter> openMetricsExporter;
     ReportManager reportManager;
     TriggerManager triggerManager;
 };
@@ -8,6 +8,7 @@
 #include "utils/contains.hpp"
 #include "utils/conversion_trigger.hpp"
 #include "utils/dbus_path_utils.hpp"
+#include "utils/json_writer.hpp"
 #include "utils/transform.hpp"
 
 #include <phosphor-logging/log.hpp>
@@ -232,26 +233,38 @@ bool Trigger::storeConfiguration() const
 {
     try
     {
-        nlohmann::json data;
+        std::string data;
+        utils::JsonWriter json(data);
 
         auto labeledThresholdParams =
             std::visit(utils::ToLabeledThresholdParamConversion(),
                        fromLabeledThresholdParam(getLabeledThresholds()));
 
-        data["Version"] = triggerVersion;
-        data["Id"] = *id;
-        data["Name"] = name;
-        data["ThresholdParamsDiscriminator"] = labeledThresholdParams.index();
-        data["TriggerActions"] =
-            utils::transform(triggerActions, [](const auto& action) {
-                return actionToString(action);
-            });
-        data["ThresholdParams"] =
-            utils::labeledThresholdParamsToJson(labeledThresholdParams);
-        data["ReportIds"] = *reportIds;
-        data["Sensors"] = getLabeledSensorInfo();
+        json.beginObject();
+        json.member("Id", *id);
+        json.member("Name", name);
+        json.member("ReportIds", *reportIds);
+        json.key("Sensors");
+        json.beginArray();
+        for (const auto& sensor : sensors)
+        {
+            json.write(sensor->getLabeledSensorInfo());
+        }
+        json.endArray();
+        json.member("ThresholdParams", labeledThresholdParams);
+        json.member("ThresholdParamsDiscriminator",
+                    labeledThresholdParams.index());
+        json.key("TriggerActions");
+        json.beginArray();
+        for (const auto& action : triggerActions)
+        {
+            json.write(actionToString(action));
+        }
+        json.endArray();
+        json.member("Version", triggerVersion);
+        json.endObject();
 
-        triggerStorage.store(fileName, data);
+        triggerStorage.storeSerialized(fileName, data);
     }
     catch (const std::exception& e)
     {
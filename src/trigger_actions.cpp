@@ -6,9 +6,8 @@
 #include "utils/messanger.hpp"
 #include "utils/to_short_enum.hpp"
 
-#include <phosphor-logging/log.hpp>
-
 #include <ctime>
+#include <format>
 #include <iomanip>
 #include <sstream>
 
@@ -79,21 +78,18 @@ void LogToRedfishEventLog::commit(
     if (std::string_view(messageId) ==
         redfish_message_ids::TriggerNumericReadingNormal)
     {
-        phosphor::logging::log<phosphor::logging::level::INFO>(
-            "Logging numeric trigger action to Redfish Event Log.",
-            phosphor::logging::entry("REDFISH_MESSAGE_ID=%s", messageId),
-            phosphor::logging::entry("REDFISH_MESSAGE_ARGS=%s,%f,%s",
-                                     sensorName.c_str(), value,
-                                     triggerId.c_str()));
+        eventLogQueue.push(
+            "Logging numeric trigger action to Redfish Event Log.", messageId,
+            triggerId, sensorName,
+            std::format("{},{:f},{}", sensorName, value, triggerId));
     }
     else
     {
-        phosphor::logging::log<phosphor::logging::level::INFO>(
-            "Logging numeric trigger action to Redfish Event Log.",
-            phosphor::logging::entry("REDFISH_MESSAGE_ID=%s", messageId),
-            phosphor::logging::entry("REDFISH_MESSAGE_ARGS=%s,%f,%f,%s",
-                                     sensorName.c_str(), value, threshold,
-                                     triggerId.c_str()));
+        eventLogQueue.push(
+            "Logging numeric trigger action to Redfish Event Log.", messageId,
+            triggerId, sensorName,
+            std::format("{},{:f},{:f},{}", sensorName, value, threshold,
+                        triggerId));
     }
 }
 
@@ -101,6 +97,7 @@ void fillActions(
     std::vector<std::unique_ptr<interfaces::TriggerAction>>& actionsIf,
     const std::vector<TriggerAction>& ActionsEnum, ::numeric::Type type,
     double thresholdValue, boost::asio::io_context& ioc,
+    EventLogQueue& eventLogQueue,
     const std::shared_ptr<std::vector<std::string>>& reportIds)
 {
     actionsIf.reserve(ActionsEnum.size());
@@ -111,7 +108,7 @@ void fillActions(
             case TriggerAction::LogToRedfishEventLog:
             {
                 actionsIf.emplace_back(std::make_unique<LogToRedfishEventLog>(
-                    type, thresholdValue));
+                    eventLogQueue, type, thresholdValue));
                 break;
             }
             case TriggerAction::UpdateReport:
@@ -134,22 +131,19 @@ void LogToRedfishEventLog::commit(
     const std::string& sensorName, const Milliseconds timestamp,
     const TriggerValue triggerValue)
 {
-    auto value = std::get<std::string>(triggerValue);
-
-    phosphor::logging::log<phosphor::logging::level::INFO>(
-        "Logging discrete trigger action to Redfish Event Log.",
-        phosphor::logging::entry(
-            "REDFISH_MESSAGE_ID=%s",
-            redfish_message_ids::TriggerDiscreteConditionMet),
-        phosphor::logging::entry("REDFISH_MESSAGE_ARGS=%s,%s,%s",
-                                 sensorName.c_str(), value.c_str(),
-                                 triggerId.c_str()));
+    const auto& value = std::get<std::string>(triggerValue);
+
+    eventLogQueue.push("Logging discrete trigger action to Redfish Event Log.",
+                       redfish_message_ids::TriggerDiscreteConditionMet,
+                       triggerId, sensorName,
+                       std::format("{},{},{}", sensorName, value, triggerId));
 }
 
 void fillActions(
     std::vector<std::unique_ptr<interfaces::TriggerAction>>& actionsIf,
     const std::vector<TriggerAction>& ActionsEnum,
     ::discrete::Severity severity, boost::asio::io_context& ioc,
+    EventLogQueue& eventLogQueue,
     const std::shared_ptr<std::vector<std::string>>& reportIds)
 {
     actionsIf.reserve(ActionsEnum.size());
@@ -160,7 +154,7 @@ void fillActions(
             case TriggerAction::LogToRedfishEventLog:
             {
                 actionsIf.emplace_back(
-                    std::make_unique<LogToRedfishEventLog>());
+                    std::make_unique<LogToRedfishEventLog>(eventLogQueue));
                 break;
             }
             case TriggerAction::UpdateReport:
@@ -183,19 +177,16 @@ void LogToRedfishEventLog::commit(
 {
     auto value = triggerValueToString(triggerValue);
 
-    phosphor::logging::log<phosphor::logging::level::INFO>(
+    eventLogQueue.push(
         "Logging onChange discrete trigger action to Redfish Event Log.",
-        phosphor::logging::entry(
-            "REDFISH_MESSAGE_ID=%s",
-            redfish_message_ids::TriggerDiscreteConditionMet),
-        phosphor::logging::entry("REDFISH_MESSAGE_ARGS=%s,%s,%s",
-                                 sensorName.c_str(), value.c_str(),
-                                 triggerId.c_str()));
+        redfish_message_ids::TriggerDiscreteConditionMet, triggerId,
+        sensorName, std::format("{},{},{}", sensorName, value, triggerId));
 }
 
 void fillActions(
     std::vector<std::unique_ptr<interfaces::TriggerAction>>& actionsIf,
     const std::vector<TriggerAction>& ActionsEnum, boost::asio::io_context& ioc,
+    EventLogQueue& eventLogQueue,
     const std::shared_ptr<std::vector<std::string>>& reportIds)
 {
     actionsIf.reserve(ActionsEnum.size());
@@ -206,7 +197,7 @@ void fillActions(
             case TriggerAction::LogToRedfishEventLog:
             {
                 actionsIf.emplace_back(
-                    std::make_unique<LogToRedfishEventLog>());
+                    std::make_unique<LogToRedfishEventLog>(eventLogQueue));
                 break;
             }
             case TriggerAction::UpdateReport:
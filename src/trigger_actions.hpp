@@ -1,5 +1,6 @@
 #pragma once
 
+#include "event_log_queue.hpp"
 #include "interfaces/trigger_action.hpp"
 #include "types/trigger_types.hpp"
 
@@ -34,8 +35,9 @@ namespace numeric
 class LogToRedfishEventLog : public interfaces::TriggerAction
 {
   public:
-    LogToRedfishEventLog(::numeric::Type type, double val) :
-        type(type), threshold(val)
+    LogToRedfishEventLog(EventLogQueue& eventLogQueue, ::numeric::Type type,
+                         double val) :
+        eventLogQueue(eventLogQueue), type(type), threshold(val)
     {}
 
     void commit(const std::string& triggerId, const ThresholdName thresholdName,
@@ -43,6 +45,7 @@ class LogToRedfishEventLog : public interfaces::TriggerAction
                 const TriggerValue value) override;
 
   private:
+    EventLogQueue& eventLogQueue;
     const ::numeric::Type type;
     const double threshold;
 
@@ -53,6 +56,7 @@ void fillActions(
     std::vector<std::unique_ptr<interfaces::TriggerAction>>& actionsIf,
     const std::vector<TriggerAction>& ActionsEnum, ::numeric::Type type,
     double thresholdValue, boost::asio::io_context& ioc,
+    EventLogQueue& eventLogQueue,
     const std::shared_ptr<std::vector<std::string>>& reportIds);
 } // namespace numeric
 
@@ -62,17 +66,23 @@ namespace discrete
 class LogToRedfishEventLog : public interfaces::TriggerAction
 {
   public:
-    explicit LogToRedfishEventLog() {}
+    explicit LogToRedfishEventLog(EventLogQueue& eventLogQueue) :
+        eventLogQueue(eventLogQueue)
+    {}
 
     void commit(const std::string& triggerId, const ThresholdName thresholdName,
                 const std::string& sensorName, const Milliseconds timestamp,
                 const TriggerValue value) override;
+
+  private:
+    EventLogQueue& eventLogQueue;
 };
 
 void fillActions(
     std::vector<std::unique_ptr<interfaces::TriggerAction>>& actionsIf,
     const std::vector<TriggerAction>& ActionsEnum,
     ::discrete::Severity severity, boost::asio::io_context& ioc,
+    EventLogQueue& eventLogQueue,
     const std::shared_ptr<std::vector<std::string>>& reportIds);
 
 namespace onChange
@@ -81,16 +91,22 @@ namespace onChange
 class LogToRedfishEventLog : public interfaces::TriggerAction
 {
   public:
-    LogToRedfishEventLog() {}
+    explicit LogToRedfishEventLog(EventLogQueue& eventLogQueue) :
+        eventLogQueue(eventLogQueue)
+    {}
 
     void commit(const std::string& triggerId, const ThresholdName thresholdName,
                 const std::string& sensorName, const Milliseconds timestamp,
                 const TriggerValue value) override;
+
+  private:
+    EventLogQueue& eventLogQueue;
 };
 
 void fillActions(
     std::vector<std::unique_ptr<interfaces::TriggerAction>>& actionsIf,
     const std::vector<TriggerAction>& ActionsEnum, boost::asio::io_context& ioc,
+    EventLogQueue& eventLogQueue,
     const std::shared_ptr<std::vector<std::string>>& reportIds);
 } // namespace onChange
 
@@ -7,17 +7,23 @@
 #include "trigger.hpp"
 #include "trigger_actions.hpp"
 #include "utils/clock.hpp"
-#include "utils/dbus_mapper.hpp"
 #include "utils/transform.hpp"
 
+#include <algorithm>
+
 namespace ts = utils::tstring;
 
 TriggerFactory::TriggerFactory(
     std::shared_ptr<sdbusplus::asio::connection> bus,
     std::shared_ptr<sdbusplus::asio::object_server> objServer,
-    SensorCache& sensorCache) :
+    SensorCache& sensorCache, SensorDirectory& sensorDirectory,
+    SamplingScheduler& samplingScheduler) :
     bus(std::move(bus)), objServer(std::move(objServer)),
-    sensorCache(sensorCache)
+    sensorCache(sensorCache), sensorDirectory(sensorDirectory),
+    samplingScheduler(samplingScheduler),
+    timerWheel(this->bus->get_io_context()),
+    eventLogQueue(this->bus->get_io_context(), EventLogQueue::defaultLimits(),
+                  std::make_unique<Clock>())
 {}
 
 void TriggerFactory::updateDiscreteThresholds(
@@ -166,10 +172,11 @@ void TriggerFactory::makeDiscreteThreshold(
         thresholdParam.at_label<ts::ThresholdValue>();
 
     action::discrete::fillActions(actions, triggerActions, severity,
-                                  bus->get_io_context(), reportIds);
+                                  bus->get_io_context(), eventLogQueue,
+                                  reportIds);
 
     thresholds.emplace_back(std::make_shared<DiscreteThreshold>(
-        bus->get_io_context(), triggerId, sensors, std::move(actions),
+        timerWheel, triggerId, sensors, std::move(actions),
         Milliseconds(dwellTime), thresholdValue, thresholdName, severity,
         std::make_unique<Clock>()));
 }
@@ -190,11 +197,13 @@ void TriggerFactory::makeNumericThreshold(
     auto thresholdValue = double{thresholdParam.at_label<ts::ThresholdValue>()};
 
     action::numeric::fillActions(actions, triggerActions, type, thresholdValue,
-                                 bus->get_io_context(), reportIds);
+                                 bus->get_io_context(), eventLogQueue,
+                                 reportIds);
 
     thresholds.emplace_back(std::make_shared<NumericThreshold>(
-        bus->get_io_context(), triggerId, sensors, std::move(actions),
-        dwellTime, direction, thresholdValue, type, std::make_unique<Clock>()));
+        timerWheel, triggerId, sensors, std::move(actions), dwellTime,
+        direction, thresholdValue, type, std::make_unique<Clock>(),
+        numericThresholdTables));
 }
 
 void TriggerFactory::makeOnChangeThreshold(
@@ -207,7 +216,8 @@ void TriggerFactory::makeOnChangeThreshold(
     std::vector<std::unique_ptr<interfaces::TriggerAction>> actions;
 
     action::discrete::onChange::fillActions(actions, triggerActions,
-                                            bus->get_io_context(), reportIds);
+                                            bus->get_io_context(),
+                                            eventLogQueue, reportIds);
 
     thresholds.emplace_back(std::make_shared<OnChangeThreshold>(
         triggerId, sensors, std::move(actions), std::make_unique<Clock>()));
@@ -276,7 +286,8 @@ void TriggerFactory::updateSensors(
         const auto& metadata = labeledSensorInfo.at_label<ts::Metadata>();
 
         newSensors.emplace_back(sensorCache.makeSensor<Sensor>(
-            service, sensorPath, metadata, bus->get_io_context(), bus));
+            service, sensorPath, metadata, bus->get_io_context(), bus,
+            &samplingScheduler));
     }
 
     currentSensors = std::move(newSensors);
@@ -289,8 +300,11 @@ std::vector<LabeledSensorInfo> TriggerFactory::getLabeledSensorsInfo(
     {
         return {};
     }
-    auto tree = utils::getSubTreeSensors(yield, bus);
-    return parseSensorTree(tree, sensorsInfo);
+    if (!isInSensorDirectory(sensorsInfo))
+    {
+        sensorDirectory.refresh(yield);
+    }
+    return getLabeledSensorsInfoFromSensorDirectory(sensorsInfo);
 }
 
 std::vector<LabeledSensorInfo> TriggerFactory::getLabeledSensorsInfo(
@@ -300,23 +314,34 @@ std::vector<LabeledSensorInfo> TriggerFactory::getLabeledSensorsInfo(
     {
         return {};
     }
-    auto tree = utils::getSubTreeSensors(bus);
-    return parseSensorTree(tree, sensorsInfo);
+    // Used from property setters which cannot yield, only sensors missing
+    // from the directory are looked up
+    if (!isInSensorDirectory(sensorsInfo))
+    {
+        sensorDirectory.resolve(utils::transform(
+            sensorsInfo, [](const auto& item) { return item.first.str; }));
+    }
+    return getLabeledSensorsInfoFromSensorDirectory(sensorsInfo);
+}
+
+bool TriggerFactory::isInSensorDirectory(const SensorsInfo& sensorsInfo) const
+{
+    return std::ranges::all_of(sensorsInfo, [this](const auto& item) {
+        return sensorDirectory.find(item.first.str) != nullptr;
+    });
 }
 
-std::vector<LabeledSensorInfo> TriggerFactory::parseSensorTree(
-    const std::vector<utils::SensorTree>& tree, const SensorsInfo& sensorsInfo)
+std::vector<LabeledSensorInfo>
+    TriggerFactory::getLabeledSensorsInfoFromSensorDirectory(
+        const SensorsInfo& sensorsInfo) const
 {
-    return utils::transform(sensorsInfo, [&tree](const auto& item) {
+    return utils::transform(sensorsInfo, [this](const auto& item) {
         const auto& [sensorPath, metadata] = item;
-        auto found = std::find_if(
-            tree.begin(), tree.end(),
-            [path = sensorPath](const auto& x) { return x.first == path; });
+        const auto* services = sensorDirectory.find(sensorPath.str);
 
-        if (tree.end() != found)
+        if (services && !services->empty())
         {
-            const auto& [service, ifaces] = found->second.front();
-            return LabeledSensorInfo(service, sensorPath, metadata);
+            return LabeledSensorInfo(services->front(), sensorPath, metadata);
         }
         throw std::runtime_error("Not found");
     });
@@ -1,11 +1,15 @@
 #pragma once
 
+#include "event_log_queue.hpp"
 #include "interfaces/report_manager.hpp"
 #include "interfaces/sensor.hpp"
 #include "interfaces/threshold.hpp"
 #include "interfaces/trigger_factory.hpp"
+#include "numeric_threshold_table.hpp"
+#include "sampling_scheduler.hpp"
 #include "sensor_cache.hpp"
-#include "utils/dbus_mapper.hpp"
+#include "sensor_directory.hpp"
+#include "utils/timer_wheel.hpp"
 
 #include <sdbusplus/asio/object_server.hpp>
 
@@ -14,7 +18,8 @@ class TriggerFactory : public interfaces::TriggerFactory
   public:
     TriggerFactory(std::shared_ptr<sdbusplus::asio::connection> bus,
                    std::shared_ptr<sdbusplus::asio::object_server> objServer,
-                   SensorCache& sensorCache);
+                   SensorCache& sensorCache, SensorDirectory& sensorDirectory,
+                   SamplingScheduler& samplingScheduler);
 
     std::unique_ptr<interfaces::Trigger> make(
         const std::string& id, const std::string& name,
@@ -44,17 +49,27 @@ class TriggerFactory : public interfaces::TriggerFactory
                        const std::vector<LabeledSensorInfo>& labeledSensorsInfo)
         const override;
 
+    EventLogCounters getEventLogCounters() const override
+    {
+        return eventLogQueue.getCounters();
+    }
+
   private:
     std::shared_ptr<sdbusplus::asio::connection> bus;
     std::shared_ptr<sdbusplus::asio::object_server> objServer;
     SensorCache& sensorCache;
+    SensorDirectory& sensorDirectory;
+    SamplingScheduler& samplingScheduler;
+    mutable NumericThresholdTables numericThresholdTables;
+    mutable utils::TimerWheel timerWheel;
+    mutable EventLogQueue eventLogQueue;
 
     Sensors getSensors(
         const std::vector<LabeledSensorInfo>& labeledSensorsInfo) const;
 
-    static std::vector<LabeledSensorInfo> parseSensorTree(
-        const std::vector<utils::SensorTree>& tree,
-        const SensorsInfo& sensorsInfo);
+    bool isInSensorDirectory(const SensorsInfo& sensorsInfo) const;
+    std::vector<LabeledSensorInfo> getLabeledSensorsInfoFromSensorDirectory(
+        const SensorsInfo& sensorsInfo) const;
 
     void updateDiscreteThresholds(
         std::vector<std::shared_ptr<interfaces::Threshold>>& currentThresholds,
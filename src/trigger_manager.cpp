@@ -4,6 +4,7 @@
 #include "types/trigger_types.hpp"
 #include "utils/conversion_trigger.hpp"
 #include "utils/dbus_path_utils.hpp"
+#include "utils/json_reader.hpp"
 #include "utils/make_id_name.hpp"
 #include "utils/transform.hpp"
 #include "utils/tstring.hpp"
@@ -63,10 +64,30 @@ TriggerManager::TriggerManager(
                 .getPath();
         });
     managerIface->initialize();
+
+    eventLogIface =
+        objServer->add_interface(triggerManagerPath, eventLogInterface);
+    eventLogIface->register_property_r<uint64_t>(
+        "LoggedEvents", sdbusplus::vtable::property_::none,
+        [this](const auto&) {
+            return triggerFactory->getEventLogCounters().logged;
+        });
+    eventLogIface->register_property_r<uint64_t>(
+        "SuppressedEvents", sdbusplus::vtable::property_::none,
+        [this](const auto&) {
+            return triggerFactory->getEventLogCounters().suppressed;
+        });
+    eventLogIface->register_property_r<uint64_t>(
+        "DroppedEvents", sdbusplus::vtable::property_::none,
+        [this](const auto&) {
+            return triggerFactory->getEventLogCounters().dropped;
+        });
+    eventLogIface->initialize();
 }
 
 TriggerManager::~TriggerManager()
 {
+    objServer->remove_interface(eventLogIface);
     objServer->remove_interface(managerIface);
 }
 
@@ -156,46 +177,91 @@ void TriggerManager::loadFromPersistent()
 
     for (const auto& path : paths)
     {
-        std::optional<nlohmann::json> data = triggerStorage->load(path);
+        std::optional<std::string> data = triggerStorage->loadSerialized(path);
         try
         {
             if (!data.has_value())
             {
                 throw std::runtime_error("Empty storage");
             }
-            size_t version = data->at("Version").get<size_t>();
-            if (version != Trigger::triggerVersion)
+
+            std::optional<size_t> version;
+            std::optional<std::string> id;
+            std::optional<std::string> name;
+            std::optional<int> thresholdParamsDiscriminator;
+            std::optional<std::vector<std::string>> triggerActions;
+            std::optional<std::string_view> thresholdParams;
+            std::optional<std::vector<std::string>> reportIds;
+            std::optional<std::vector<LabeledSensorInfo>> labeledSensorsInfo;
+
+            utils::JsonReader json(*data);
+            std::string_view key;
+
+            json.beginObject();
+            while (json.nextKey(key))
+            {
+                if (key == "Version")
+                {
+                    version = json.read<size_t>();
+                }
+                else if (key == "Id")
+                {
+                    id = json.read<std::string>();
+                }
+                else if (key == "Name")
+                {
+                    name = json.read<std::string>();
+                }
+                else if (key == "ThresholdParamsDiscriminator")
+                {
+                    thresholdParamsDiscriminator = json.read<int>();
+                }
+                else if (key == "TriggerActions")
+                {
+                    triggerActions = json.read<std::vector<std::string>>();
+                }
+                else if (key == "ThresholdParams")
+                {
+                    thresholdParams = json.skipValue();
+                }
+                else if (key == "ReportIds")
+                {
+                    reportIds = json.read<std::vector<std::string>>();
+                }
+                else if (key == "Sensors")
+                {
+                    labeledSensorsInfo =
+                        json.read<std::vector<LabeledSensorInfo>>();
+                }
+                else
+                {
+                    json.skipValue();
+                }
+            }
+            json.end();
+
+            if (version.value() != Trigger::triggerVersion)
             {
                 throw std::runtime_error("Invalid version");
             }
-            const std::string& id = data->at("Id").get_ref<std::string&>();
-            const std::string& name = data->at("Name").get_ref<std::string&>();
-            int thresholdParamsDiscriminator =
-                data->at("ThresholdParamsDiscriminator").get<int>();
-            const std::vector<std::string> triggerActions =
-                data->at("TriggerActions").get<std::vector<std::string>>();
 
+            utils::JsonReader thresholdParamsJson(thresholdParams.value());
             LabeledTriggerThresholdParams labeledThresholdParams;
-            if (0 == thresholdParamsDiscriminator)
+            if (0 == thresholdParamsDiscriminator.value())
             {
                 labeledThresholdParams =
-                    data->at("ThresholdParams")
-                        .get<std::vector<numeric::LabeledThresholdParam>>();
+                    thresholdParamsJson
+                        .read<std::vector<numeric::LabeledThresholdParam>>();
             }
             else
             {
                 labeledThresholdParams =
-                    data->at("ThresholdParams")
-                        .get<std::vector<discrete::LabeledThresholdParam>>();
+                    thresholdParamsJson
+                        .read<std::vector<discrete::LabeledThresholdParam>>();
             }
 
-            auto reportIds =
-                data->at("ReportIds").get<std::vector<std::string>>();
-
-            auto labeledSensorsInfo =
-                data->at("Sensors").get<std::vector<LabeledSensorInfo>>();
-
-            addTrigger(id, name, triggerActions, labeledSensorsInfo, reportIds,
+            addTrigger(id.value(), name.value(), triggerActions.value(),
+                       labeledSensorsInfo.value(), reportIds.value(),
                        labeledThresholdParams);
         }
         catch (const std::exception& e)
@@ -36,6 +36,7 @@ class TriggerManager : public interfaces::TriggerManager
     std::unique_ptr<interfaces::JsonStorage> triggerStorage;
     std::shared_ptr<sdbusplus::asio::object_server> objServer;
     std::shared_ptr<sdbusplus::asio::dbus_interface> managerIface;
+    std::shared_ptr<sdbusplus::asio::dbus_interface> eventLogIface;
     std::vector<std::unique_ptr<interfaces::Trigger>> triggers;
 
     void verifyAddTrigger(
@@ -54,6 +55,8 @@ class TriggerManager : public interfaces::TriggerManager
     static constexpr size_t maxTriggers{TELEMETRY_MAX_TRIGGERS};
     static constexpr const char* triggerManagerPath =
         "/xyz/openbmc_project/Telemetry/Triggers";
+    static constexpr const char* eventLogInterface =
+        "xyz.openbmc_project.Telemetry.EventLog";
     static constexpr std::string_view triggerNameDefault = "Trigger";
 
     static_assert(!triggerNameDefault.empty(),
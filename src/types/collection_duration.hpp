@@ -1,6 +1,8 @@
 #pragma once
 
 #include "types/duration_types.hpp"
+#include "utils/json_reader.hpp"
+#include "utils/json_writer.hpp"
 
 #include <boost/serialization/strong_typedef.hpp>
 #include <nlohmann/json.hpp>
@@ -19,3 +21,13 @@ inline void from_json(const nlohmann::json& json, CollectionDuration& value)
 {
     value = CollectionDuration(Milliseconds(json.get<uint64_t>()));
 }
+
+inline void write_json(utils::JsonWriter& json, const CollectionDuration& value)
+{
+    json.write(value.t.count());
+}
+
+inline void read_json(utils::JsonReader& json, CollectionDuration& value)
+{
+    value = CollectionDuration(Milliseconds(json.read<uint64_t>()));
+}
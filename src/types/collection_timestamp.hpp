@@ -0,0 +1,13 @@
+#pragma once
+
+#include "types/duration_types.hpp"
+
+/** Clock readings taken once per report update and shared by all metrics of
+ * the report, so every reading collected in one update carries the same
+ * timestamp.
+ */
+struct CollectionTimestamp
+{
+    Milliseconds steady;
+    Milliseconds system;
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+/** Totals of trigger action journal entries handled by EventLogQueue */
+struct EventLogCounters
+{
+    uint64_t logged = 0;
+    uint64_t suppressed = 0;
+    uint64_t dropped = 0;
+};
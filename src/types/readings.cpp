@@ -2,6 +2,8 @@
 
 #include "utils/transform.hpp"
 
+#include <stdexcept>
+
 namespace utils
 {
 
@@ -25,4 +27,58 @@ Readings toReadings(const LabeledReadings& labeledReadings)
                                      })};
 }
 
+void writeLabeledReadings(JsonWriter& json, const Readings& readings)
+{
+    json.beginObject();
+    json.member(detail::labelName<ts::Timestamp>(), std::get<0>(readings));
+    json.key(detail::labelName<ts::Readings>());
+    json.beginArray();
+    for (const auto& readingData : std::get<1>(readings))
+    {
+        LabeledReadingData::write_tuple(json, readingData);
+    }
+    json.endArray();
+    json.endObject();
+}
+
+Readings readLabeledReadings(JsonReader& json)
+{
+    Readings readings;
+    bool hasTimestamp = false;
+    bool hasReadings = false;
+    std::string_view key;
+
+    json.beginObject();
+    while (json.nextKey(key))
+    {
+        if (key == detail::labelName<ts::Timestamp>())
+        {
+            json.read(std::get<0>(readings));
+            hasTimestamp = true;
+        }
+        else if (key == detail::labelName<ts::Readings>())
+        {
+            auto& readingsData = std::get<1>(readings);
+            readingsData.clear();
+            json.beginArray();
+            while (json.nextElement())
+            {
+                LabeledReadingData::read_tuple(json,
+                                               readingsData.emplace_back());
+            }
+            hasReadings = true;
+        }
+        else
+        {
+            json.skipValue();
+        }
+    }
+
+    if (!hasTimestamp || !hasReadings)
+    {
+        throw std::out_of_range("Incomplete MetricValues");
+    }
+    return readings;
+}
+
 } // namespace utils
@@ -20,4 +20,8 @@ namespace utils
 LabeledReadings toLabeledReadings(const Readings&);
 Readings toReadings(const LabeledReadings&);
 
+/** Streams Readings in the LabeledReadings layout without converting them */
+void writeLabeledReadings(JsonWriter&, const Readings&);
+Readings readLabeledReadings(JsonReader&);
+
 } // namespace utils
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "types/duration_types.hpp"
+#include "utils/conversion.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+enum class SamplingMode : uint32_t
+{
+    signal,
+    poll,
+    signalRateLimited
+};
+
+struct SamplingPolicy
+{
+    SamplingMode mode = SamplingMode::signal;
+    Milliseconds interval = Milliseconds{0};
+
+    bool operator==(const SamplingPolicy&) const = default;
+};
+
+namespace utils
+{
+
+template <>
+struct EnumTraits<SamplingMode>
+{
+    static constexpr auto propertyName = ConstexprString{"SamplingMode"};
+};
+
+constexpr auto convDataSamplingMode = std::array{
+    std::make_pair<std::string_view, SamplingMode>("Signal",
+                                                   SamplingMode::signal),
+    std::make_pair<std::string_view, SamplingMode>("Poll", SamplingMode::poll),
+    std::make_pair<std::string_view, SamplingMode>(
+        "SignalRateLimited", SamplingMode::signalRateLimited)};
+
+inline SamplingMode toSamplingMode(const std::string& value)
+{
+    return toEnum(convDataSamplingMode, value);
+}
+
+inline std::string enumToString(SamplingMode value)
+{
+    return std::string(enumToString(convDataSamplingMode, value));
+}
+
+} // namespace utils
@@ -0,0 +1,103 @@
+#include "types/sensor_id.hpp"
+
+#include <boost/container_hash/hash.hpp>
+
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+namespace
+{
+
+using Key = std::tuple<std::string_view, std::string_view, std::string_view>;
+
+struct KeyHash
+{
+    size_t operator()(const Key& key) const noexcept
+    {
+        size_t seed = 0;
+        boost::hash_combine(seed, std::get<0>(key));
+        boost::hash_combine(seed, std::get<1>(key));
+        boost::hash_combine(seed, std::get<2>(key));
+        return seed;
+    }
+};
+
+struct Entry
+{
+    std::string type;
+    std::string service;
+    std::string path;
+    size_t hash;
+};
+
+class InternTable
+{
+  public:
+    static InternTable& instance()
+    {
+        static InternTable table;
+        return table;
+    }
+
+    SensorId::Handle intern(const Key& key)
+    {
+        if (auto it = index.find(key); it != index.end())
+        {
+            return it->second;
+        }
+
+        if (entries.size() > std::numeric_limits<SensorId::Handle>::max())
+        {
+            throw std::length_error("Too many sensor ids");
+        }
+
+        // Keys view strings owned by the entry, std::deque keeps elements in
+        // place when growing.
+        const auto& entry = entries.emplace_back(
+            Entry{std::string(std::get<0>(key)), std::string(std::get<1>(key)),
+                  std::string(std::get<2>(key)), KeyHash{}(key)});
+        const auto handle = static_cast<SensorId::Handle>(entries.size() - 1);
+        index.emplace(Key{entry.type, entry.service, entry.path}, handle);
+
+        return handle;
+    }
+
+    const Entry& get(SensorId::Handle handle) const
+    {
+        return entries[handle];
+    }
+
+  private:
+    std::deque<Entry> entries;
+    std::unordered_map<Key, SensorId::Handle, KeyHash> index;
+};
+
+} // namespace
+
+SensorId::SensorId(std::string_view type, std::string_view service,
+                   std::string_view path) :
+    idHandle(InternTable::instance().intern(Key{type, service, path}))
+{}
+
+const std::string& SensorId::type() const
+{
+    return InternTable::instance().get(idHandle).type;
+}
+
+const std::string& SensorId::service() const
+{
+    return InternTable::instance().get(idHandle).service;
+}
+
+const std::string& SensorId::path() const
+{
+    return InternTable::instance().get(idHandle).path;
+}
+
+size_t SensorId::hash() const
+{
+    return InternTable::instance().get(idHandle).hash;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/** Identity of a sensor interned into a process wide table.
+ *
+ * Equal identities share one table entry, so an id is a 32-bit handle that
+ * is cheap to copy, compares in O(1) and carries a precomputed hash. Entries
+ * are never released, the set of sensors seen by the daemon is bounded by
+ * the sensors present in the system.
+ */
+class SensorId
+{
+  public:
+    using Handle = uint32_t;
+
+    struct Hash
+    {
+        size_t operator()(const SensorId& id) const noexcept
+        {
+            return id.hash();
+        }
+    };
+
+    SensorId(std::string_view type, std::string_view service,
+             std::string_view path);
+
+    const std::string& type() const;
+    const std::string& service() const;
+    const std::string& path() const;
+    size_t hash() const;
+
+    Handle handle() const
+    {
+        return idHandle;
+    }
+
+    bool operator==(const SensorId& other) const
+    {
+        return idHandle == other.idHandle;
+    }
+
+    std::string str() const
+    {
+        return type() + ":" + service() + ":" + path();
+    }
+
+  private:
+    Handle idHandle;
+};
@@ -0,0 +1,351 @@
+#include "utils/compressed_readings.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace utils
+{
+
+namespace
+{
+
+constexpr uint32_t noSuccessor = std::numeric_limits<uint32_t>::max();
+constexpr size_t minChunkSize = 16;
+constexpr size_t maxChunkSize = 1024;
+
+constexpr uint64_t mask(unsigned bits)
+{
+    return bits == 64 ? ~uint64_t{0} : (uint64_t{1} << bits) - 1;
+}
+
+/** Delta of delta buckets: prefix value, prefix length, payload bits */
+struct TimestampBucket
+{
+    uint64_t prefix;
+    unsigned prefixBits;
+    unsigned bits;
+};
+
+constexpr TimestampBucket timestampBuckets[] = {
+    {0b10, 2, 7}, {0b110, 3, 9}, {0b1110, 4, 12}, {0b1111, 4, 64}};
+
+class BitWriter
+{
+  public:
+    BitWriter(std::vector<uint64_t>& words, size_t& bitCount) :
+        words(words), bitCount(bitCount)
+    {}
+
+    void write(uint64_t value, unsigned bits)
+    {
+        value &= mask(bits);
+        const unsigned used = bitCount % 64;
+        if (used == 0)
+        {
+            words.push_back(0);
+        }
+
+        const unsigned free = 64 - used;
+        if (bits <= free)
+        {
+            words.back() |= value << (free - bits);
+        }
+        else
+        {
+            words.back() |= value >> (bits - free);
+            words.push_back(value << (64 - (bits - free)));
+        }
+        bitCount += bits;
+    }
+
+  private:
+    std::vector<uint64_t>& words;
+    size_t& bitCount;
+};
+
+class BitReader
+{
+  public:
+    explicit BitReader(const std::vector<uint64_t>& words) : words(words) {}
+
+    uint64_t read(unsigned bits)
+    {
+        const size_t word = pos / 64;
+        const unsigned free = 64 - pos % 64;
+        pos += bits;
+
+        if (bits <= free)
+        {
+            return (words[word] >> (free - bits)) & mask(bits);
+        }
+
+        const unsigned rest = bits - free;
+        return ((words[word] & mask(free)) << rest) |
+               (words[word + 1] >> (64 - rest));
+    }
+
+    bool readBit()
+    {
+        return read(1) != 0;
+    }
+
+  private:
+    const std::vector<uint64_t>& words;
+    size_t pos = 0;
+};
+
+int64_t signExtend(uint64_t value, unsigned bits)
+{
+    const unsigned shift = 64 - bits;
+    return static_cast<int64_t>(value << shift) >> shift;
+}
+
+} // namespace
+
+CompressedReadings::CompressedReadings(size_t maxSizeIn)
+{
+    clearAndResize(maxSizeIn);
+}
+
+void CompressedReadings::clear()
+{
+    total = 0;
+    dropped = 0;
+    ids.clear();
+    idIndexes.clear();
+    chunks.clear();
+    series.clear();
+    successors.clear();
+    previousIndex = 0;
+}
+
+void CompressedReadings::clearAndResize(size_t newMaxSize)
+{
+    clear();
+    maxSize = newMaxSize;
+    chunkSize = std::clamp(maxSize / 4, minChunkSize, maxChunkSize);
+}
+
+void CompressedReadings::startChunk()
+{
+    if (!chunks.empty())
+    {
+        chunks.back().words.shrink_to_fit();
+    }
+    chunks.emplace_back();
+    series.assign(ids.size(), SeriesState{});
+    successors.assign(ids.size(), noSuccessor);
+}
+
+void CompressedReadings::emplace(const std::string& metricId, double value,
+                                 uint64_t timestamp)
+{
+    if (maxSize == 0)
+    {
+        return;
+    }
+
+    auto [it, inserted] =
+        idIndexes.try_emplace(metricId, static_cast<uint32_t>(ids.size()));
+    if (inserted)
+    {
+        ids.emplace_back(metricId);
+        series.emplace_back();
+        successors.emplace_back(noSuccessor);
+    }
+    const uint32_t index = it->second;
+
+    if (chunks.empty() || chunks.back().count == chunkSize)
+    {
+        startChunk();
+    }
+    auto& chunk = chunks.back();
+    BitWriter out(chunk.words, chunk.bitCount);
+
+    if (chunk.count > 0 && successors[previousIndex] == index)
+    {
+        out.write(0, 1);
+    }
+    else
+    {
+        if (chunk.count > 0)
+        {
+            out.write(1, 1);
+            successors[previousIndex] = index;
+        }
+        out.write(index, 32);
+    }
+    previousIndex = index;
+
+    auto& state = series[index];
+    if (!state.started)
+    {
+        out.write(timestamp, 64);
+    }
+    else
+    {
+        const auto delta = static_cast<int64_t>(timestamp - state.timestamp);
+        const int64_t deltaOfDelta = delta - state.delta;
+        state.delta = delta;
+
+        if (deltaOfDelta == 0)
+        {
+            out.write(0, 1);
+        }
+        else
+        {
+            for (const auto& bucket : timestampBuckets)
+            {
+                const int64_t limit = bucket.bits == 64
+                                          ? std::numeric_limits<int64_t>::max()
+                                          : int64_t{1} << (bucket.bits - 1);
+                if (bucket.bits == 64 ||
+                    (deltaOfDelta >= -limit && deltaOfDelta < limit))
+                {
+                    out.write(bucket.prefix, bucket.prefixBits);
+                    out.write(static_cast<uint64_t>(deltaOfDelta), bucket.bits);
+                    break;
+                }
+            }
+        }
+    }
+    state.timestamp = timestamp;
+
+    const auto bits = std::bit_cast<uint64_t>(value);
+    const uint64_t xorBits = bits ^ state.value;
+    state.value = bits;
+    state.started = true;
+
+    if (xorBits == 0)
+    {
+        out.write(0, 1);
+    }
+    else
+    {
+        const auto leading = static_cast<unsigned>(std::countl_zero(xorBits));
+        const auto trailing = static_cast<unsigned>(std::countr_zero(xorBits));
+        if (state.hasWindow && leading >= state.leading &&
+            trailing >= state.trailing)
+        {
+            out.write(0b10, 2);
+            out.write(xorBits >> state.trailing,
+                      64 - state.leading - state.trailing);
+        }
+        else
+        {
+            const unsigned meaningful = 64 - leading - trailing;
+            out.write(0b11, 2);
+            out.write(leading, 6);
+            out.write(meaningful - 1, 6);
+            out.write(xorBits >> trailing, meaningful);
+            state.hasWindow = true;
+            state.leading = leading;
+            state.trailing = trailing;
+        }
+    }
+
+    ++chunk.count;
+    ++total;
+
+    while (chunks.size() > 1 &&
+           total - dropped - chunks.front().count >= maxSize)
+    {
+        dropped += chunks.front().count;
+        chunks.pop_front();
+    }
+}
+
+std::vector<ReadingData> CompressedReadings::decode() const
+{
+    const size_t retained = std::min(total, maxSize);
+    std::vector<ReadingData> result(retained);
+
+    size_t position = dropped;
+    for (const auto& chunk : chunks)
+    {
+        BitReader in(chunk.words);
+        std::vector<SeriesState> states(ids.size());
+        std::vector<uint32_t> chunkSuccessors(ids.size(), noSuccessor);
+        uint32_t index = 0;
+
+        for (size_t i = 0; i < chunk.count; ++i, ++position)
+        {
+            if (i > 0 && !in.readBit())
+            {
+                index = chunkSuccessors[index];
+            }
+            else
+            {
+                const auto next = static_cast<uint32_t>(in.read(32));
+                if (i > 0)
+                {
+                    chunkSuccessors[index] = next;
+                }
+                index = next;
+            }
+
+            auto& state = states[index];
+            if (!state.started)
+            {
+                state.timestamp = in.read(64);
+            }
+            else
+            {
+                int64_t deltaOfDelta = 0;
+                if (in.readBit())
+                {
+                    unsigned bits = 64;
+                    for (const auto& bucket : timestampBuckets)
+                    {
+                        // Every prefix after the first bit is a run of ones
+                        // ended by a zero, except for the last one
+                        if (bucket.bits == 64 || !in.readBit())
+                        {
+                            bits = bucket.bits;
+                            break;
+                        }
+                    }
+                    deltaOfDelta = signExtend(in.read(bits), bits);
+                }
+                state.delta += deltaOfDelta;
+                state.timestamp += static_cast<uint64_t>(state.delta);
+            }
+            state.started = true;
+
+            if (in.readBit())
+            {
+                if (in.readBit())
+                {
+                    state.leading = static_cast<unsigned>(in.read(6));
+                    const auto meaningful =
+                        static_cast<unsigned>(in.read(6)) + 1;
+                    state.trailing = 64 - state.leading - meaningful;
+                }
+                const unsigned meaningful = 64 - state.leading - state.trailing;
+                state.value ^= in.read(meaningful) << state.trailing;
+            }
+
+            if (position + retained >= total)
+            {
+                result[position % maxSize] = ReadingData(
+                    ids[index], std::bit_cast<double>(state.value),
+                    state.timestamp);
+            }
+        }
+    }
+
+    return result;
+}
+
+size_t CompressedReadings::encodedSize() const
+{
+    size_t size = 0;
+    for (const auto& chunk : chunks)
+    {
+        size += chunk.words.capacity() * sizeof(uint64_t);
+    }
+    return size;
+}
+
+} // namespace utils
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "types/readings.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace utils
+{
+
+/** Compressed replacement of CircularVector<ReadingData> for append reports.
+ *
+ *  Readings are encoded Gorilla style into chunks of a bit stream: metric id
+ *  index predicted from the id that followed the previous one, delta of
+ *  delta timestamps and XOR of the value with the previous value of the same
+ *  metric. An unchanged reading of a periodic report takes three bits. Every
+ *  chunk is decoded independently, so the oldest one is dropped once newer
+ *  chunks hold maxSize readings. decode() returns readings in the same order
+ *  CircularVector would keep them. */
+class CompressedReadings
+{
+  public:
+    explicit CompressedReadings(size_t maxSize);
+
+    void emplace(const std::string& metricId, double value, uint64_t timestamp);
+    void clear();
+    void clearAndResize(size_t newMaxSize);
+
+    bool isFull() const
+    {
+        return total >= maxSize;
+    }
+
+    size_t size() const
+    {
+        return maxSize;
+    }
+
+    std::vector<ReadingData> decode() const;
+
+    /** Bytes taken by encoded chunks, without metric ids */
+    size_t encodedSize() const;
+
+  private:
+    struct Chunk
+    {
+        std::vector<uint64_t> words;
+        size_t bitCount = 0;
+        size_t count = 0;
+    };
+
+    struct SeriesState
+    {
+        bool started = false;
+        uint64_t timestamp = 0;
+        int64_t delta = 0;
+        uint64_t value = 0;
+        bool hasWindow = false;
+        unsigned leading = 0;
+        unsigned trailing = 0;
+    };
+
+    void startChunk();
+
+    size_t maxSize;
+    size_t chunkSize;
+    size_t total = 0;
+    size_t dropped = 0;
+    std::vector<std::string> ids;
+    std::unordered_map<std::string, uint32_t> idIndexes;
+    std::deque<Chunk> chunks;
+    std::vector<SeriesState> series;
+    std::vector<uint32_t> successors;
+    uint32_t previousIndex = 0;
+};
+
+} // namespace utils
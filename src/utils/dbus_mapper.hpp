@@ -41,18 +41,18 @@ inline std::vector<SensorTree> getSubTreeSensors(
     return tree;
 }
 
-inline std::vector<SensorTree> getSubTreeSensors(
-    const std::shared_ptr<sdbusplus::asio::connection>& bus)
+/** Services hosting a single sensor, blocks until ObjectMapper replies */
+inline SensorIfaces getObjectSensor(
+    const std::shared_ptr<sdbusplus::asio::connection>& bus,
+    const std::string& path)
 {
     auto method_call = bus->new_method_call(
         ObjectMapper::default_service, ObjectMapper::instance_path,
-        ObjectMapper::interface, ObjectMapper::method_names::get_sub_tree);
-    method_call.append(SensorValue::namespace_path::value, 2, sensorInterfaces);
+        ObjectMapper::interface, ObjectMapper::method_names::get_object);
+    method_call.append(path, sensorInterfaces);
     auto reply = bus->call(method_call);
 
-    auto tree = reply.unpack<std::vector<SensorTree>>();
-
-    return tree;
+    return reply.unpack<SensorIfaces>();
 }
 
 } // namespace utils
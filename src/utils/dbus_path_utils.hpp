@@ -13,6 +13,7 @@ namespace utils
 
 namespace constants
 {
+constexpr const char* telemetryPath = "/xyz/openbmc_project/Telemetry";
 constexpr std::string_view triggerDirStr =
     "/xyz/openbmc_project/Telemetry/Triggers/";
 constexpr std::string_view reportDirStr =
@@ -0,0 +1,38 @@
+#include "utils/file_descriptor.hpp"
+
+#include <unistd.h>
+
+#include <utility>
+
+namespace utils
+{
+
+FileDescriptor::FileDescriptor(FileDescriptor&& other) noexcept :
+    fd(std::exchange(other.fd, -1))
+{}
+
+FileDescriptor& FileDescriptor::operator=(FileDescriptor&& other) noexcept
+{
+    if (this != &other)
+    {
+        reset();
+        fd = std::exchange(other.fd, -1);
+    }
+    return *this;
+}
+
+FileDescriptor::~FileDescriptor()
+{
+    reset();
+}
+
+void FileDescriptor::reset()
+{
+    if (fd >= 0)
+    {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+} // namespace utils
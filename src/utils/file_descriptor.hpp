@@ -0,0 +1,27 @@
+#pragma once
+
+namespace utils
+{
+
+/** Owns a file descriptor and closes it on destruction */
+class FileDescriptor
+{
+  public:
+    FileDescriptor() = default;
+    explicit FileDescriptor(int fd) : fd(fd) {}
+    FileDescriptor(FileDescriptor&& other) noexcept;
+    FileDescriptor& operator=(FileDescriptor&& other) noexcept;
+    ~FileDescriptor();
+
+    int get() const
+    {
+        return fd;
+    }
+
+    void reset();
+
+  private:
+    int fd = -1;
+};
+
+} // namespace utils
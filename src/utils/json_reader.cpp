@@ -0,0 +1,404 @@
+#include "utils/json_reader.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <stdexcept>
+
+namespace utils
+{
+
+namespace
+{
+
+bool isWhitespace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/** Accepts numbers like 1e3 or 2.0 which nlohmann writes for some values */
+bool isInteger(double value)
+{
+    return std::isfinite(value) && std::trunc(value) == value;
+}
+
+void appendUtf8(std::string& out, uint32_t codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        out.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        out.push_back(static_cast<char>(0xc0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xe0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xf0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    }
+}
+
+} // namespace
+
+void JsonReader::fail(std::string_view what) const
+{
+    throw std::runtime_error(
+        std::format("Invalid JSON at offset {}: {}", pos, what));
+}
+
+char JsonReader::peek()
+{
+    while (pos < text.size() && isWhitespace(text[pos]))
+    {
+        ++pos;
+    }
+    if (pos == text.size())
+    {
+        fail("unexpected end of input");
+    }
+    return text[pos];
+}
+
+void JsonReader::expect(char c)
+{
+    if (peek() != c)
+    {
+        fail(std::format("expected '{}'", c));
+    }
+    ++pos;
+}
+
+void JsonReader::beginObject()
+{
+    expect('{');
+    afterOpening = true;
+}
+
+bool JsonReader::nextKey(std::string_view& key)
+{
+    if (peek() == '}')
+    {
+        ++pos;
+        afterOpening = false;
+        return false;
+    }
+    if (!afterOpening)
+    {
+        expect(',');
+    }
+    afterOpening = false;
+
+    key = stringToken(keyBuffer);
+    expect(':');
+    return true;
+}
+
+void JsonReader::beginArray()
+{
+    expect('[');
+    afterOpening = true;
+}
+
+bool JsonReader::nextElement()
+{
+    if (peek() == ']')
+    {
+        ++pos;
+        afterOpening = false;
+        return false;
+    }
+    if (!afterOpening)
+    {
+        expect(',');
+    }
+    afterOpening = false;
+    return true;
+}
+
+void JsonReader::end()
+{
+    while (pos < text.size() && isWhitespace(text[pos]))
+    {
+        ++pos;
+    }
+    if (pos != text.size())
+    {
+        fail("trailing characters");
+    }
+}
+
+bool JsonReader::readBool()
+{
+    const auto token = literalToken();
+    if (token == "true")
+    {
+        return true;
+    }
+    if (token != "false")
+    {
+        fail("expected boolean");
+    }
+    return false;
+}
+
+double JsonReader::readDouble()
+{
+    if (peek() == '"')
+    {
+        const auto literal = stringToken(stringBuffer);
+        if (literal == "NaN")
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (literal == "inf")
+        {
+            return std::numeric_limits<double>::infinity();
+        }
+        if (literal == "-inf")
+        {
+            return -std::numeric_limits<double>::infinity();
+        }
+        fail("unknown numeric literal");
+    }
+
+    return toDouble(numberToken());
+}
+
+int64_t JsonReader::readInt64()
+{
+    const auto token = numberToken();
+    int64_t result = 0;
+    auto [end, ec] =
+        std::from_chars(token.data(), token.data() + token.size(), result);
+    if (ec == std::errc() && end == token.data() + token.size())
+    {
+        return result;
+    }
+    const double value = toDouble(token);
+    if (!isInteger(value) || value < -0x1p63 || value >= 0x1p63)
+    {
+        fail("expected 64 bit integer");
+    }
+    return static_cast<int64_t>(value);
+}
+
+uint64_t JsonReader::readUint64()
+{
+    const auto token = numberToken();
+    uint64_t result = 0;
+    auto [end, ec] =
+        std::from_chars(token.data(), token.data() + token.size(), result);
+    if (ec == std::errc() && end == token.data() + token.size())
+    {
+        return result;
+    }
+    const double value = toDouble(token);
+    if (!isInteger(value) || value < 0.0 || value >= 0x1p64)
+    {
+        fail("expected unsigned 64 bit integer");
+    }
+    return static_cast<uint64_t>(value);
+}
+
+double JsonReader::toDouble(std::string_view token) const
+{
+    double result = 0.0;
+    auto [end, ec] =
+        std::from_chars(token.data(), token.data() + token.size(), result);
+    if (ec != std::errc() || end != token.data() + token.size())
+    {
+        fail("expected number");
+    }
+    return result;
+}
+
+void JsonReader::readString(std::string& item)
+{
+    item.assign(stringToken(stringBuffer));
+}
+
+std::string_view JsonReader::skipValue()
+{
+    const char c = peek();
+    const size_t begin = pos;
+
+    if (c == '{')
+    {
+        beginObject();
+        std::string_view key;
+        while (nextKey(key))
+        {
+            skipValue();
+        }
+    }
+    else if (c == '[')
+    {
+        beginArray();
+        while (nextElement())
+        {
+            skipValue();
+        }
+    }
+    else if (c == '"')
+    {
+        stringToken(stringBuffer);
+    }
+    else if (c == 't' || c == 'f' || c == 'n')
+    {
+        const auto token = literalToken();
+        if (token != "true" && token != "false" && token != "null")
+        {
+            fail("unknown literal");
+        }
+    }
+    else
+    {
+        numberToken();
+    }
+
+    return text.substr(begin, pos - begin);
+}
+
+std::string_view JsonReader::literalToken()
+{
+    peek();
+    const size_t begin = pos;
+    while (pos < text.size() && text[pos] >= 'a' && text[pos] <= 'z')
+    {
+        ++pos;
+    }
+    return text.substr(begin, pos - begin);
+}
+
+std::string_view JsonReader::numberToken()
+{
+    peek();
+    const size_t begin = pos;
+    while (pos < text.size() &&
+           std::string_view("+-.0123456789eE").find(text[pos]) !=
+               std::string_view::npos)
+    {
+        ++pos;
+    }
+    if (pos == begin)
+    {
+        fail("expected number");
+    }
+    return text.substr(begin, pos - begin);
+}
+
+std::string_view JsonReader::stringToken(std::string& scratch)
+{
+    expect('"');
+
+    const size_t begin = pos;
+    while (pos < text.size() && text[pos] != '"' && text[pos] != '\\')
+    {
+        ++pos;
+    }
+    if (pos == text.size())
+    {
+        fail("unterminated string");
+    }
+    if (text[pos] == '"')
+    {
+        return text.substr(begin, pos++ - begin);
+    }
+
+    scratch.assign(text.substr(begin, pos - begin));
+    while (pos < text.size() && text[pos] != '"')
+    {
+        if (text[pos] != '\\')
+        {
+            scratch.push_back(text[pos++]);
+            continue;
+        }
+        if (++pos == text.size())
+        {
+            fail("unterminated string");
+        }
+        switch (const char escaped = text[pos++])
+        {
+            case '"':
+            case '\\':
+            case '/':
+                scratch.push_back(escaped);
+                break;
+            case 'b':
+                scratch.push_back('\b');
+                break;
+            case 'f':
+                scratch.push_back('\f');
+                break;
+            case 'n':
+                scratch.push_back('\n');
+                break;
+            case 'r':
+                scratch.push_back('\r');
+                break;
+            case 't':
+                scratch.push_back('\t');
+                break;
+            case 'u':
+            {
+                auto readHex = [this] {
+                    uint32_t value = 0;
+                    auto [end, ec] = std::from_chars(
+                        text.data() + pos,
+                        text.data() + std::min(pos + 4, text.size()), value,
+                        16);
+                    if (ec != std::errc() || end != text.data() + pos + 4)
+                    {
+                        fail("invalid unicode escape");
+                    }
+                    pos += 4;
+                    return value;
+                };
+                uint32_t codePoint = readHex();
+                if (codePoint >= 0xdc00 && codePoint <= 0xdfff)
+                {
+                    fail("unpaired low surrogate");
+                }
+                if (codePoint >= 0xd800 && codePoint <= 0xdbff)
+                {
+                    if (text.substr(pos, 2) != "\\u")
+                    {
+                        fail("unpaired high surrogate");
+                    }
+                    pos += 2;
+                    const uint32_t low = readHex();
+                    if (low < 0xdc00 || low > 0xdfff)
+                    {
+                        fail("invalid low surrogate");
+                    }
+                    codePoint =
+                        0x10000 + ((codePoint - 0xd800) << 10) + (low - 0xdc00);
+                }
+                appendUtf8(scratch, codePoint);
+                break;
+            }
+            default:
+                fail("invalid escape");
+        }
+    }
+    if (pos == text.size())
+    {
+        fail("unterminated string");
+    }
+    ++pos;
+    return scratch;
+}
+
+} // namespace utils
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace utils
+{
+
+/** Pull parser reading JSON text straight into typed values.
+ *
+ *  Objects are walked with beginObject() and nextKey(), arrays with
+ *  beginArray() and nextElement(). Malformed input throws
+ *  std::runtime_error. */
+class JsonReader
+{
+  public:
+    explicit JsonReader(std::string_view text) : text(text) {}
+
+    void beginObject();
+    /** Returns false after consuming the closing brace. The key stays valid
+     *  until the next key is read. */
+    bool nextKey(std::string_view& key);
+    void beginArray();
+    bool nextElement();
+    void end();
+
+    bool readBool();
+    double readDouble();
+    int64_t readInt64();
+    uint64_t readUint64();
+    void readString(std::string& item);
+    /** Skips the next value and returns its raw text */
+    std::string_view skipValue();
+
+    template <class T>
+    T read()
+    {
+        T item{};
+        read(item);
+        return item;
+    }
+
+    template <class T>
+    void read(T& item)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            item = readBool();
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            item = static_cast<T>(read<std::underlying_type_t<T>>());
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            item = static_cast<T>(readDouble());
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+        {
+            item = narrow<T>(readInt64());
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            item = narrow<T>(readUint64());
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+        {
+            readString(item);
+        }
+        else if constexpr (requires { item.read_json(*this); })
+        {
+            item.read_json(*this);
+        }
+        else if constexpr (requires { item.emplace_back(); })
+        {
+            item.clear();
+            beginArray();
+            while (nextElement())
+            {
+                read(item.emplace_back());
+            }
+        }
+        else
+        {
+            read_json(*this, item);
+        }
+    }
+
+  private:
+    std::string_view text;
+    size_t pos = 0;
+    bool afterOpening = false;
+    std::string keyBuffer;
+    std::string stringBuffer;
+
+    char peek();
+    void expect(char c);
+    std::string_view literalToken();
+    std::string_view numberToken();
+    std::string_view stringToken(std::string& scratch);
+    double toDouble(std::string_view token) const;
+    [[noreturn]] void fail(std::string_view what) const;
+
+    template <class T, class U>
+    T narrow(U value) const
+    {
+        if (!std::in_range<T>(value))
+        {
+            fail("integer out of range");
+        }
+        return static_cast<T>(value);
+    }
+};
+
+} // namespace utils
@@ -0,0 +1,157 @@
+#include "utils/json_writer.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+
+namespace utils
+{
+
+void JsonWriter::separate()
+{
+    if (needsComma)
+    {
+        out.push_back(',');
+    }
+}
+
+void JsonWriter::beginObject()
+{
+    separate();
+    out.push_back('{');
+    needsComma = false;
+}
+
+void JsonWriter::endObject()
+{
+    out.push_back('}');
+    needsComma = true;
+}
+
+void JsonWriter::beginArray()
+{
+    separate();
+    out.push_back('[');
+    needsComma = false;
+}
+
+void JsonWriter::endArray()
+{
+    out.push_back(']');
+    needsComma = true;
+}
+
+void JsonWriter::key(std::string_view name)
+{
+    value(name);
+    out.push_back(':');
+    needsComma = false;
+}
+
+void JsonWriter::null()
+{
+    separate();
+    out.append("null");
+    needsComma = true;
+}
+
+void JsonWriter::value(bool item)
+{
+    separate();
+    out.append(item ? "true" : "false");
+    needsComma = true;
+}
+
+void JsonWriter::value(int64_t item)
+{
+    separate();
+    std::array<char, 24> buffer;
+    auto [end, ec] = std::to_chars(buffer.begin(), buffer.end(), item);
+    out.append(buffer.begin(), end);
+    needsComma = true;
+}
+
+void JsonWriter::value(uint64_t item)
+{
+    separate();
+    std::array<char, 24> buffer;
+    auto [end, ec] = std::to_chars(buffer.begin(), buffer.end(), item);
+    out.append(buffer.begin(), end);
+    needsComma = true;
+}
+
+void JsonWriter::value(double item)
+{
+    if (std::isnan(item))
+    {
+        value(std::string_view("NaN"));
+        return;
+    }
+    if (std::isinf(item))
+    {
+        value(std::string_view(item > 0 ? "inf" : "-inf"));
+        return;
+    }
+
+    separate();
+    std::array<char, 32> buffer;
+    auto [end, ec] = std::to_chars(buffer.begin(), buffer.end(), item);
+    out.append(buffer.begin(), end);
+    if (std::string_view(buffer.begin(), end).find_first_of(".e") ==
+        std::string_view::npos)
+    {
+        out.append(".0");
+    }
+    needsComma = true;
+}
+
+void JsonWriter::value(std::string_view item)
+{
+    static constexpr std::string_view hexDigits = "0123456789abcdef";
+
+    separate();
+    out.push_back('"');
+    for (char c : item)
+    {
+        switch (c)
+        {
+            case '"':
+                out.append("\\\"");
+                break;
+            case '\\':
+                out.append("\\\\");
+                break;
+            case '\b':
+                out.append("\\b");
+                break;
+            case '\f':
+                out.append("\\f");
+                break;
+            case '\n':
+                out.append("\\n");
+                break;
+            case '\r':
+                out.append("\\r");
+                break;
+            case '\t':
+                out.append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    out.append("\\u00");
+                    out.push_back(hexDigits[(c >> 4) & 0xf]);
+                    out.push_back(hexDigits[c & 0xf]);
+                }
+                else
+                {
+                    out.push_back(c);
+                }
+                break;
+        }
+    }
+    out.push_back('"');
+    needsComma = true;
+}
+
+} // namespace utils
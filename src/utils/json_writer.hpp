@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace utils
+{
+
+namespace detail
+{
+
+template <class T>
+struct is_variant : std::false_type
+{};
+
+template <class... Args>
+struct is_variant<std::variant<Args...>> : std::true_type
+{};
+
+} // namespace detail
+
+/** Streams JSON text into a caller provided buffer without building a DOM.
+ *
+ *  Non finite doubles are written as "NaN", "inf" and "-inf" strings, the
+ *  same way utils::to_json stores them. */
+class JsonWriter
+{
+  public:
+    explicit JsonWriter(std::string& out) : out(out) {}
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+    void key(std::string_view name);
+
+    void null();
+    void value(bool value);
+    void value(int64_t value);
+    void value(uint64_t value);
+    void value(double value);
+    void value(std::string_view value);
+
+    template <class T>
+    void member(std::string_view name, const T& item)
+    {
+        key(name);
+        write(item);
+    }
+
+    template <class T>
+    void write(const T& item)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            value(item);
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            write(static_cast<std::underlying_type_t<T>>(item));
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            value(static_cast<double>(item));
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+        {
+            value(static_cast<int64_t>(item));
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            value(static_cast<uint64_t>(item));
+        }
+        else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+        {
+            value(std::string_view(item));
+        }
+        else if constexpr (std::is_same_v<T, std::monostate>)
+        {
+            null();
+        }
+        else if constexpr (requires { item.write_json(*this); })
+        {
+            item.write_json(*this);
+        }
+        else if constexpr (detail::is_variant<T>::value)
+        {
+            std::visit([this](const auto& alternative) { write(alternative); },
+                       item);
+        }
+        else if constexpr (std::ranges::range<T>)
+        {
+            beginArray();
+            for (const auto& element : item)
+            {
+                write(element);
+            }
+            endArray();
+        }
+        else
+        {
+            write_json(*this, item);
+        }
+    }
+
+  private:
+    std::string& out;
+    bool needsComma = false;
+
+    void separate();
+};
+
+} // namespace utils
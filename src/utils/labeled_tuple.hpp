@@ -1,10 +1,15 @@
 #pragma once
 
+#include "utils/json_reader.hpp"
+#include "utils/json_writer.hpp"
+
 #include <nlohmann/json.hpp>
 #include <sdbusplus/message/types.hpp>
 
+#include <array>
 #include <cmath>
 #include <limits>
+#include <stdexcept>
 
 namespace utils
 {
@@ -122,6 +127,13 @@ struct has_utils_to_json
 template <class T>
 constexpr bool has_utils_to_json_v = has_utils_to_json<T>::value;
 
+template <class Label>
+const std::string& labelName()
+{
+    static const std::string name = Label::str();
+    return name;
+}
+
 bool eq(const auto& a, const auto& b)
 {
     if constexpr (std::is_same<std::decay_t<decltype(a)>, double>())
@@ -178,6 +190,42 @@ struct LabeledTuple<std::tuple<Args...>, Labels...>
         return to_json().dump();
     }
 
+    void write_json(JsonWriter& writer) const
+    {
+        write_tuple(writer, value);
+    }
+
+    void read_json(JsonReader& reader)
+    {
+        read_tuple(reader, value);
+    }
+
+    /** Writes a plain tuple as if it was wrapped in this LabeledTuple */
+    static void write_tuple(JsonWriter& writer, const tuple_type& tuple)
+    {
+        writer.beginObject();
+        write_json_all(writer, tuple,
+                       std::make_index_sequence<sizeof...(Args)>());
+        writer.endObject();
+    }
+
+    static void read_tuple(JsonReader& reader, tuple_type& tuple)
+    {
+        std::array<bool, sizeof...(Args)> found{};
+        std::string_view key;
+
+        reader.beginObject();
+        while (reader.nextKey(key))
+        {
+            if (!read_json_any(reader, key, tuple, found,
+                               std::make_index_sequence<sizeof...(Args)>()))
+            {
+                reader.skipValue();
+            }
+        }
+        check_found_all(found, std::make_index_sequence<sizeof...(Args)>());
+    }
+
     template <size_t Idx>
     const auto& at_index() const
     {
@@ -243,6 +291,58 @@ struct LabeledTuple<std::tuple<Args...>, Labels...>
         }
     }
 
+    template <size_t... Idx>
+    static void write_json_all(JsonWriter& writer, const tuple_type& tuple,
+                               std::index_sequence<Idx...>)
+    {
+        (writer.member(
+             detail::labelName<
+                 std::tuple_element_t<Idx, std::tuple<Labels...>>>(),
+             std::get<Idx>(tuple)),
+         ...);
+    }
+
+    template <size_t... Idx>
+    static bool read_json_any(JsonReader& reader, std::string_view key,
+                              tuple_type& tuple,
+                              std::array<bool, sizeof...(Args)>& found,
+                              std::index_sequence<Idx...>)
+    {
+        return (read_json_item<Idx>(reader, key, tuple, found) || ...);
+    }
+
+    template <size_t Idx>
+    static bool read_json_item(JsonReader& reader, std::string_view key,
+                               tuple_type& tuple,
+                               std::array<bool, sizeof...(Args)>& found)
+    {
+        using Label = std::tuple_element_t<Idx, std::tuple<Labels...>>;
+        if (key != detail::labelName<Label>())
+        {
+            return false;
+        }
+        reader.read(std::get<Idx>(tuple));
+        found[Idx] = true;
+        return true;
+    }
+
+    template <size_t... Idx>
+    static void check_found_all(const std::array<bool, sizeof...(Args)>& found,
+                                std::index_sequence<Idx...>)
+    {
+        (check_found<Idx>(found), ...);
+    }
+
+    template <size_t Idx>
+    static void check_found(const std::array<bool, sizeof...(Args)>& found)
+    {
+        using Label = std::tuple_element_t<Idx, std::tuple<Labels...>>;
+        if (!found[Idx])
+        {
+            throw std::out_of_range("Missing key " + Label::str());
+        }
+    }
+
     template <size_t... Idx>
     void from_json_all(const nlohmann::json& j, std::index_sequence<Idx...>)
     {
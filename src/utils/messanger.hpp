@@ -38,6 +38,12 @@ class MessangerT
         service_.send(event);
     }
 
+    template <class EventType>
+    bool has_receivers() const
+    {
+        return service_.template has_handlers<EventType>();
+    }
+
   private:
     Service& service_;
     typename Service::Context& context_;
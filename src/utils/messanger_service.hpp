@@ -43,6 +43,24 @@ class MessangerService : public boost::asio::execution_context::service
         }
     }
 
+    template <class T>
+    bool has_handlers() const
+    {
+        using HandlerType = std::function<void(const T&)>;
+
+        for (const auto& context : contexts_)
+        {
+            for (const auto& any : context->handlers)
+            {
+                if (std::any_cast<HandlerType>(&any))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
     static boost::asio::execution_context::id id;
 
   private:
@@ -0,0 +1,86 @@
+#include "utils/properties_changed.hpp"
+
+#include <systemd/sd-bus.h>
+
+namespace utils
+{
+
+namespace
+{
+
+bool readVariant(sd_bus_message* m, ChangedProperty& result)
+{
+    char type = 0;
+    const char* contents = nullptr;
+    if (sd_bus_message_peek_type(m, &type, &contents) < 0 ||
+        type != SD_BUS_TYPE_VARIANT)
+    {
+        return false;
+    }
+
+    if (std::string_view(contents) != "d")
+    {
+        return sd_bus_message_skip(m, "v") >= 0;
+    }
+
+    double value = 0.0;
+    if (sd_bus_message_enter_container(m, SD_BUS_TYPE_VARIANT, "d") <= 0 ||
+        sd_bus_message_read_basic(m, SD_BUS_TYPE_DOUBLE, &value) < 0 ||
+        sd_bus_message_exit_container(m) < 0)
+    {
+        return false;
+    }
+
+    result.value = value;
+    return true;
+}
+
+} // namespace
+
+ChangedProperty readChangedProperty(sdbusplus::message_t& message,
+                                    std::string_view interface,
+                                    std::string_view property)
+{
+    sd_bus_message* m = message.get();
+
+    const char* iface = nullptr;
+    if (sd_bus_message_read_basic(m, SD_BUS_TYPE_STRING, &iface) < 0 ||
+        interface != iface)
+    {
+        return {};
+    }
+
+    if (sd_bus_message_enter_container(m, SD_BUS_TYPE_ARRAY, "{sv}") <= 0)
+    {
+        return {};
+    }
+
+    while (sd_bus_message_enter_container(m, SD_BUS_TYPE_DICT_ENTRY, "sv") > 0)
+    {
+        const char* name = nullptr;
+        if (sd_bus_message_read_basic(m, SD_BUS_TYPE_STRING, &name) < 0)
+        {
+            return {};
+        }
+
+        if (property == name)
+        {
+            ChangedProperty result{.found = true};
+            if (!readVariant(m, result))
+            {
+                return {};
+            }
+            return result;
+        }
+
+        if (sd_bus_message_skip(m, "v") < 0 ||
+            sd_bus_message_exit_container(m) < 0)
+        {
+            return {};
+        }
+    }
+
+    return {};
+}
+
+} // namespace utils
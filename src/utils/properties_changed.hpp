@@ -0,0 +1,28 @@
+#pragma once
+
+#include <sdbusplus/message.hpp>
+
+#include <optional>
+#include <string_view>
+
+namespace utils
+{
+
+struct ChangedProperty
+{
+    bool found = false;
+    std::optional<double> value;
+};
+
+/** Looks up a double property in a PropertiesChanged signal.
+ *
+ * The message is walked in place with the sd-bus container API and entries
+ * other than the requested one are skipped, so no strings or containers are
+ * allocated. Signals for other interfaces or malformed signals are reported
+ * as not found; a property holding another type is found without a value.
+ */
+ChangedProperty readChangedProperty(sdbusplus::message_t& message,
+                                    std::string_view interface,
+                                    std::string_view property);
+
+} // namespace utils
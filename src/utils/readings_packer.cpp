@@ -0,0 +1,182 @@
+#include "utils/readings_packer.hpp"
+
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace utils
+{
+
+namespace
+{
+
+template <class T>
+using UnsignedOf = std::conditional_t<
+    sizeof(T) == 8, uint64_t,
+    std::conditional_t<sizeof(T) == 4, uint32_t, uint16_t>>;
+
+template <class T>
+void append(std::vector<uint8_t>& out, T value)
+{
+    auto bits = std::bit_cast<UnsignedOf<T>>(value);
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        bits = std::byteswap(bits);
+    }
+
+    const auto offset = out.size();
+    out.resize(offset + sizeof(bits));
+    std::memcpy(out.data() + offset, &bits, sizeof(bits));
+}
+
+class Cursor
+{
+  public:
+    explicit Cursor(std::span<const uint8_t> data) : data(data) {}
+
+    template <class T>
+    T read()
+    {
+        UnsignedOf<T> bits;
+        std::memcpy(&bits, bytes(sizeof(bits)).data(), sizeof(bits));
+        if constexpr (std::endian::native == std::endian::big)
+        {
+            bits = std::byteswap(bits);
+        }
+        return std::bit_cast<T>(bits);
+    }
+
+    std::span<const uint8_t> bytes(size_t size)
+    {
+        if (data.size() - pos < size)
+        {
+            throw std::invalid_argument("Truncated ReadingsPacked");
+        }
+        auto result = data.subspan(pos, size);
+        pos += size;
+        return result;
+    }
+
+    size_t remaining() const
+    {
+        return data.size() - pos;
+    }
+
+    bool atEnd() const
+    {
+        return pos == data.size();
+    }
+
+  private:
+    std::span<const uint8_t> data;
+    size_t pos = 0;
+};
+
+} // namespace
+
+void ReadingsPacker::pack(const Readings& readings)
+{
+    const auto& [timestamp, values] = readings;
+
+    dictionary.clear();
+    indexes.clear();
+    for (const auto& [metricId, value, readingTimestamp] : values)
+    {
+        indexes.emplace_back(
+            dictionary
+                .try_emplace(metricId, static_cast<uint32_t>(dictionary.size()))
+                .first->second);
+    }
+
+    std::vector<std::string_view> ids(dictionary.size());
+    for (const auto& [metricId, index] : dictionary)
+    {
+        ids[index] = metricId;
+    }
+
+    buffer.clear();
+    append(buffer, version);
+    append(buffer, uint16_t{0});
+    append(buffer, static_cast<uint32_t>(values.size()));
+    append(buffer, timestamp);
+    append(buffer, static_cast<uint32_t>(ids.size()));
+    for (const auto& metricId : ids)
+    {
+        append(buffer, static_cast<uint32_t>(metricId.size()));
+        buffer.insert(buffer.end(), metricId.begin(), metricId.end());
+    }
+    for (const auto index : indexes)
+    {
+        append(buffer, index);
+    }
+    for (const auto& reading : values)
+    {
+        append(buffer, std::get<2>(reading));
+    }
+    for (const auto& reading : values)
+    {
+        append(buffer, std::get<1>(reading));
+    }
+}
+
+Readings ReadingsPacker::unpack(std::span<const uint8_t> data)
+{
+    Cursor cursor(data);
+
+    if (cursor.read<uint16_t>() != version)
+    {
+        throw std::invalid_argument("Unsupported ReadingsPacked version");
+    }
+    cursor.read<uint16_t>();
+
+    const auto count = cursor.read<uint32_t>();
+    Readings result;
+    auto& [timestamp, values] = result;
+    timestamp = cursor.read<uint64_t>();
+
+    const auto idCount = cursor.read<uint32_t>();
+    constexpr size_t minIdSize = sizeof(uint32_t);
+    constexpr size_t readingSize =
+        sizeof(uint32_t) + sizeof(uint64_t) + sizeof(double);
+    if (idCount > cursor.remaining() / minIdSize ||
+        count > cursor.remaining() / readingSize)
+    {
+        throw std::invalid_argument("Truncated ReadingsPacked");
+    }
+
+    std::vector<std::string> ids(idCount);
+    for (auto& metricId : ids)
+    {
+        const auto bytes = cursor.bytes(cursor.read<uint32_t>());
+        metricId.assign(bytes.begin(), bytes.end());
+    }
+
+    values.resize(count);
+    for (auto& reading : values)
+    {
+        const auto index = cursor.read<uint32_t>();
+        if (index >= ids.size())
+        {
+            throw std::invalid_argument("Invalid ReadingsPacked metric index");
+        }
+        std::get<0>(reading) = ids[index];
+    }
+    for (auto& reading : values)
+    {
+        std::get<2>(reading) = cursor.read<uint64_t>();
+    }
+    for (auto& reading : values)
+    {
+        std::get<1>(reading) = cursor.read<double>();
+    }
+
+    if (!cursor.atEnd())
+    {
+        throw std::invalid_argument("Trailing bytes in ReadingsPacked");
+    }
+
+    return result;
+}
+
+} // namespace utils
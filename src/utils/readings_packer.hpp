@@ -0,0 +1,45 @@
+#pragma once
+
+#include "types/readings.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace utils
+{
+
+/** Encodes Readings into the ReadingsPacked byte array.
+ *
+ *  Layout, all integers and doubles little endian:
+ *    u16 version, u16 reserved, u32 readings count, u64 timestamp,
+ *    u32 metric id count, then for every metric id u32 length and bytes,
+ *    u32 metric id index per reading, u64 timestamp per reading and
+ *    f64 value per reading.
+ *
+ *  The output buffer and the id dictionary keep their capacity between
+ *  updates. */
+class ReadingsPacker
+{
+  public:
+    static constexpr uint16_t version = 1;
+
+    void pack(const Readings& readings);
+
+    const std::vector<uint8_t>& get() const
+    {
+        return buffer;
+    }
+
+    /** Throws std::invalid_argument on malformed or unsupported input */
+    static Readings unpack(std::span<const uint8_t> data);
+
+  private:
+    std::vector<uint8_t> buffer;
+    std::unordered_map<std::string_view, uint32_t> dictionary;
+    std::vector<uint32_t> indexes;
+};
+
+} // namespace utils
@@ -0,0 +1,185 @@
+#include "utils/timer_wheel.hpp"
+
+#include <algorithm>
+
+namespace utils
+{
+
+TimerWheel::Timer::Timer(TimerWheel& wheel, std::function<void()> callback) :
+    wheel(wheel), callback(std::move(callback))
+{}
+
+TimerWheel::Timer::~Timer()
+{
+    cancel();
+}
+
+void TimerWheel::Timer::start(Milliseconds delay)
+{
+    wheel.add(*this, delay);
+}
+
+void TimerWheel::Timer::cancel()
+{
+    if (list != nullptr)
+    {
+        wheel.remove(*this);
+    }
+}
+
+TimerWheel::TimerWheel(boost::asio::io_context& ioc) :
+    timer(ioc), base(Clock::now()), currentTick(0)
+{}
+
+TimerWheel::~TimerWheel()
+{
+    for (Timer* head : slots)
+    {
+        for (Timer* it = head; it != nullptr; it = it->next)
+        {
+            it->list = nullptr;
+        }
+    }
+}
+
+uint64_t TimerWheel::ticksSinceBase(Clock::time_point timePoint) const
+{
+    return static_cast<uint64_t>((timePoint - base) / resolution);
+}
+
+void TimerWheel::link(Timer& entry, Timer*& list)
+{
+    entry.prev = nullptr;
+    entry.next = list;
+    if (list != nullptr)
+    {
+        list->prev = &entry;
+    }
+    list = &entry;
+    entry.list = &list;
+    ++pendingCount;
+}
+
+void TimerWheel::unlink(Timer& entry)
+{
+    if (entry.prev != nullptr)
+    {
+        entry.prev->next = entry.next;
+    }
+    else
+    {
+        *entry.list = entry.next;
+    }
+    if (entry.next != nullptr)
+    {
+        entry.next->prev = entry.prev;
+    }
+    entry.prev = nullptr;
+    entry.next = nullptr;
+    entry.list = nullptr;
+    --pendingCount;
+}
+
+void TimerWheel::add(Timer& entry, Milliseconds delay)
+{
+    if (entry.list != nullptr)
+    {
+        unlink(entry);
+    }
+
+    const auto now = Clock::now();
+    if (pendingCount == 0)
+    {
+        currentTick = std::max(currentTick, ticksSinceBase(now));
+    }
+
+    const auto untilExpiry = now + std::max(delay, Milliseconds::zero()) -
+                             base + resolution - Clock::duration(1);
+    const uint64_t tick = std::max(
+        static_cast<uint64_t>(untilExpiry / resolution), currentTick + 1);
+
+    entry.expiryTick = tick;
+    link(entry, slots[tick % slotCount]);
+
+    if (!advancing && (!armedTick || tick < *armedTick))
+    {
+        arm(tick);
+    }
+}
+
+void TimerWheel::remove(Timer& entry)
+{
+    unlink(entry);
+
+    if (pendingCount == 0 && armedTick)
+    {
+        timer.cancel();
+        armedTick = std::nullopt;
+    }
+}
+
+void TimerWheel::arm(uint64_t tick)
+{
+    armedTick = tick;
+    timer.expires_at(base + resolution * static_cast<int64_t>(tick));
+    timer.async_wait([this](const boost::system::error_code& ec) {
+        if (ec)
+        {
+            return;
+        }
+        advance();
+    });
+}
+
+uint64_t TimerWheel::nextTick() const
+{
+    for (uint64_t tick = currentTick + 1; tick <= currentTick + slotCount;
+         ++tick)
+    {
+        if (slots[tick % slotCount] != nullptr)
+        {
+            return tick;
+        }
+    }
+    return currentTick + slotCount;
+}
+
+void TimerWheel::advance()
+{
+    armedTick = std::nullopt;
+
+    const uint64_t nowTick = ticksSinceBase(Clock::now());
+    const uint64_t lastTick = std::min(nowTick, currentTick + slotCount);
+
+    Timer* expired = nullptr;
+    for (uint64_t tick = currentTick + 1; tick <= lastTick; ++tick)
+    {
+        for (Timer* it = slots[tick % slotCount]; it != nullptr;)
+        {
+            Timer* next = it->next;
+            if (it->expiryTick <= nowTick)
+            {
+                unlink(*it);
+                link(*it, expired);
+            }
+            it = next;
+        }
+    }
+    currentTick = std::max(currentTick, nowTick);
+
+    advancing = true;
+    while (expired != nullptr)
+    {
+        Timer& entry = *expired;
+        unlink(entry);
+        entry.callback();
+    }
+    advancing = false;
+
+    if (pendingCount > 0)
+    {
+        arm(nextTick());
+    }
+}
+
+} // namespace utils
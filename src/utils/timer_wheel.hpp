@@ -0,0 +1,89 @@
+#pragma once
+
+#include "types/duration_types.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+namespace utils
+{
+
+/** Hashed timing wheel driving many one-shot timers from one steady_timer.
+ *
+ *  Arming and cancelling a timer is O(1) and does not allocate. Expiry is
+ *  rounded up to the wheel resolution, so timers never fire early. */
+class TimerWheel
+{
+  public:
+    static constexpr size_t slotCount = 512;
+    static constexpr Milliseconds resolution = Milliseconds(10);
+
+    class Timer
+    {
+      public:
+        Timer(TimerWheel& wheel, std::function<void()> callback);
+        ~Timer();
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+        Timer(Timer&&) = delete;
+        Timer& operator=(Timer&&) = delete;
+
+        /** (Re)arms the timer, cancelling a pending expiry if there is one */
+        void start(Milliseconds delay);
+        void cancel();
+        bool isPending() const
+        {
+            return list != nullptr;
+        }
+
+      private:
+        friend TimerWheel;
+
+        TimerWheel& wheel;
+        std::function<void()> callback;
+        uint64_t expiryTick = 0;
+        Timer* prev = nullptr;
+        Timer* next = nullptr;
+        Timer** list = nullptr;
+    };
+
+    explicit TimerWheel(boost::asio::io_context& ioc);
+    ~TimerWheel();
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    size_t pending() const
+    {
+        return pendingCount;
+    }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    boost::asio::steady_timer timer;
+    const Clock::time_point base;
+    uint64_t currentTick;
+    std::optional<uint64_t> armedTick;
+    std::array<Timer*, slotCount> slots{};
+    size_t pendingCount = 0;
+    bool advancing = false;
+
+    uint64_t ticksSinceBase(Clock::time_point) const;
+    void link(Timer&, Timer*& list);
+    void unlink(Timer&);
+    void add(Timer&, Milliseconds delay);
+    void remove(Timer&);
+    void arm(uint64_t tick);
+    uint64_t nextTick() const;
+    void advance();
+};
+
+} // namespace utils
@@ -0,0 +1,32 @@
+#include "types/readings.hpp"
+#include "utils/circular_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+void circularVectorEmplace(benchmark::State& state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    std::vector<ReadingData> storage;
+    CircularVector<ReadingData> sut(storage, size);
+    const std::string metadata = "metadata";
+    uint64_t timestamp = 0;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        sut.emplace(metadata, 0.0, timestamp++);
+    }
+
+    for (auto _ : state)
+    {
+        sut.emplace(metadata, 1.0, timestamp++);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(circularVectorEmplace)->RangeMultiplier(16)->Range(1, 4096);
@@ -0,0 +1,58 @@
+#include "metrics/collection_function.hpp"
+#include "types/operation_type.hpp"
+#include "utils/conversion.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+
+void streamingStatsAddReading(benchmark::State& state)
+{
+    metrics::StreamingStats stats;
+    Milliseconds timestamp = 0ms;
+    double value = 0.0;
+
+    for (auto _ : state)
+    {
+        stats.addReading(timestamp, value);
+        benchmark::DoNotOptimize(stats);
+
+        timestamp += 1ms;
+        value += 0.5;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void collectionFunctionCalculate(benchmark::State& state)
+{
+    const auto operationType = static_cast<OperationType>(state.range(0));
+    const auto function = metrics::makeCollectionFunction(operationType);
+
+    metrics::StreamingStats stats;
+    for (uint64_t i = 0; i < 100; ++i)
+    {
+        stats.addReading(Milliseconds(i * 10), static_cast<double>(i));
+    }
+    const auto timestamp = 2000ms;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(function->calculate(stats, timestamp));
+    }
+
+    state.SetLabel(utils::enumToString(operationType));
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(streamingStatsAddReading);
+BENCHMARK(collectionFunctionCalculate)
+    ->DenseRange(utils::toUnderlying(utils::minEnumValue(
+                     utils::convDataOperationType)),
+                 utils::toUnderlying(utils::maxEnumValue(
+                     utils::convDataOperationType)));
@@ -0,0 +1,42 @@
+#include "dbus_environment.hpp"
+#include "messages/update_report_ind.hpp"
+#include "utils/messanger.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+void messangerServiceSend(benchmark::State& state)
+{
+    const auto handlerCount = static_cast<size_t>(state.range(0));
+    std::vector<std::unique_ptr<utils::Messanger>> receivers;
+    size_t received = 0;
+
+    for (size_t i = 0; i < handlerCount; ++i)
+    {
+        auto& receiver = receivers.emplace_back(
+            std::make_unique<utils::Messanger>(DbusEnvironment::getIoc()));
+        receiver->on_receive<messages::UpdateReportInd>(
+            [&received](const auto&) { ++received; });
+    }
+
+    utils::Messanger sender(DbusEnvironment::getIoc());
+    const auto event = messages::UpdateReportInd{{"Report1", "Report2"}};
+
+    for (auto _ : state)
+    {
+        sender.send(event);
+    }
+
+    benchmark::DoNotOptimize(received);
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(messangerServiceSend)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->Complexity(benchmark::oN);
@@ -0,0 +1,89 @@
+#include "fakes/clock_fake.hpp"
+#include "metric.hpp"
+#include "mocks/sensor_mock.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+namespace
+{
+
+struct MetricContext
+{
+    explicit MetricContext(
+        size_t width, CollectionTimeScope scope = CollectionTimeScope::point)
+    {
+        for (size_t i = 0; i < width; ++i)
+        {
+            auto sensor = std::make_shared<NiceMock<SensorMock>>();
+            ON_CALL(*sensor, metadata())
+                .WillByDefault(Return("metadata" + std::to_string(i)));
+            sensorMocks.emplace_back(std::move(sensor));
+        }
+
+        sut = std::make_shared<Metric>(
+            utils::convContainer<std::shared_ptr<interfaces::Sensor>>(
+                sensorMocks),
+            OperationType::avg, scope, CollectionDuration(100ms));
+    }
+
+    std::vector<std::shared_ptr<NiceMock<SensorMock>>> sensorMocks;
+    ClockFake clockFake;
+    std::shared_ptr<Metric> sut;
+};
+
+void metricSensorUpdated(benchmark::State& state)
+{
+    MetricContext ctx(static_cast<size_t>(state.range(0)));
+    auto& notifier = *ctx.sensorMocks.back();
+    Milliseconds timestamp = 0ms;
+    double value = 0.0;
+
+    for (auto _ : state)
+    {
+        ctx.sut->sensorUpdated(notifier, timestamp, value);
+
+        timestamp += 1ms;
+        value += 1.0;
+    }
+
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations());
+}
+
+void metricGetUpdatedReadings(benchmark::State& state)
+{
+    MetricContext ctx(static_cast<size_t>(state.range(0)),
+                      CollectionTimeScope::interval);
+    for (auto& sensor : ctx.sensorMocks)
+    {
+        ctx.sut->sensorUpdated(*sensor, ctx.clockFake.steadyTimestamp(), 1.0);
+    }
+
+    for (auto _ : state)
+    {
+        ctx.clockFake.advance(1ms);
+        benchmark::DoNotOptimize(
+            ctx.sut
+                ->getUpdatedReadings(
+                    {.steady = ctx.clockFake.steadyTimestamp(),
+                     .system = ctx.clockFake.systemTimestamp()})
+                .data());
+    }
+
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(metricSensorUpdated)
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->Complexity(benchmark::oN);
+BENCHMARK(metricGetUpdatedReadings)
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->Complexity(benchmark::oN);
@@ -0,0 +1,79 @@
+#include "persistent_json_storage.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+using FilePath = interfaces::JsonStorage::FilePath;
+using DirectoryPath = interfaces::JsonStorage::DirectoryPath;
+
+const DirectoryPath directory = DirectoryPath(
+    std::filesystem::temp_directory_path() / "telemetry-bench");
+const FilePath fileName = FilePath("Reports/1/file.json");
+
+nlohmann::json makeReportConfiguration(size_t metricCount)
+{
+    nlohmann::json readingParameters = nlohmann::json::array();
+    for (size_t i = 0; i < metricCount; ++i)
+    {
+        const auto index = std::to_string(i);
+        readingParameters.push_back(
+            {{"SensorPath",
+              {{{"Service", "xyz.openbmc_project.Hwmon"},
+                {"Path", "/xyz/openbmc_project/sensors/temperature/temp" +
+                             index},
+                {"Metadata", "metadata" + index}}}},
+             {"OperationType", 0},
+             {"CollectionTimeScope", 0},
+             {"CollectionDuration", 0}});
+    }
+
+    nlohmann::json data;
+    data["Enabled"] = true;
+    data["Version"] = 7;
+    data["Id"] = "Report1";
+    data["Name"] = "Report1";
+    data["ReportingType"] = 0;
+    data["ReportActions"] = nlohmann::json::array({0, 1});
+    data["Interval"] = 1000;
+    data["AppendLimit"] = 256;
+    data["ReportUpdates"] = 0;
+    data["ReadingParameters"] = std::move(readingParameters);
+    return data;
+}
+
+void persistentJsonStorageStore(benchmark::State& state)
+{
+    PersistentJsonStorage sut{directory};
+    const auto data =
+        makeReportConfiguration(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        sut.store(fileName, data);
+    }
+
+    std::filesystem::remove_all(directory);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void persistentJsonStorageLoad(benchmark::State& state)
+{
+    PersistentJsonStorage sut{directory};
+    sut.store(fileName,
+              makeReportConfiguration(static_cast<size_t>(state.range(0))));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sut.load(fileName));
+    }
+
+    std::filesystem::remove_all(directory);
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(persistentJsonStorageStore)->RangeMultiplier(8)->Range(1, 512);
+BENCHMARK(persistentJsonStorageLoad)->RangeMultiplier(8)->Range(1, 512);
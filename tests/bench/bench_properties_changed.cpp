@@ -0,0 +1,74 @@
+#include "dbus_environment.hpp"
+#include "utils/properties_changed.hpp"
+
+#include <boost/container/flat_map.hpp>
+#include <systemd/sd-bus.h>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+constexpr const char* sensorValueIface = "xyz.openbmc_project.Sensor.Value";
+
+sdbusplus::message_t makeSignal(size_t extraProperties)
+{
+    std::vector<std::pair<std::string, std::variant<double, std::string>>>
+        properties;
+    for (size_t i = 0; i < extraProperties; ++i)
+    {
+        properties.emplace_back("Property" + std::to_string(i),
+                                std::string("Unit"));
+    }
+    properties.emplace_back("Value", 21.5);
+
+    auto message = DbusEnvironment::getBus()->new_signal(
+        "/xyz/openbmc_project/sensors/temperature/bench",
+        "org.freedesktop.DBus.Properties", "PropertiesChanged");
+    message.append(sensorValueIface, properties, std::vector<std::string>{});
+    sd_bus_message_seal(message.get(), 1, 0);
+    return message;
+}
+
+void propertiesChangedDecode(benchmark::State& state)
+{
+    auto message = makeSignal(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        sd_bus_message_rewind(message.get(), 1);
+        auto changed =
+            utils::readChangedProperty(message, sensorValueIface, "Value");
+        benchmark::DoNotOptimize(changed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(propertiesChangedDecode)->Arg(0)->Arg(4)->Arg(16);
+
+void propertiesChangedDecodeIntoMap(benchmark::State& state)
+{
+    using ValueVariant = std::variant<std::monostate, double>;
+
+    auto message = makeSignal(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        sd_bus_message_rewind(message.get(), 1);
+        std::string iface;
+        boost::container::flat_map<std::string, ValueVariant> changed;
+        std::vector<std::string> invalidated;
+        try
+        {
+            message.read(iface, changed, invalidated);
+        }
+        catch (const sdbusplus::exception_t&)
+        {}
+        benchmark::DoNotOptimize(changed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(propertiesChangedDecodeIntoMap)->Arg(0);
+
+} // namespace
@@ -0,0 +1,73 @@
+#include "dbus_environment.hpp"
+#include "fakes/clock_fake.hpp"
+#include "fakes/metric_fake.hpp"
+#include "mocks/json_storage_mock.hpp"
+#include "mocks/report_factory_mock.hpp"
+#include "mocks/report_manager_mock.hpp"
+#include "report.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace testing;
+
+namespace
+{
+
+struct ReportContext
+{
+    ReportContext(ReportUpdates reportUpdates, size_t metricCount,
+                  uint64_t appendLimit)
+    {
+        std::vector<std::shared_ptr<interfaces::Metric>> metrics;
+        for (size_t i = 0; i < metricCount; ++i)
+        {
+            metrics.emplace_back(std::make_shared<MetricFake>(
+                std::vector<MetricValue>{MetricValue{
+                    "metadata" + std::to_string(i), static_cast<double>(i),
+                    i}}));
+        }
+
+        sut = std::make_unique<Report>(
+            DbusEnvironment::getIoc(), DbusEnvironment::getBus(),
+            DbusEnvironment::getObjServer(), "BenchReport", "BenchReport",
+            ReportingType::onChange, std::vector<ReportAction>{},
+            Milliseconds{}, appendLimit,
+            reportUpdates, reportManagerMock, storageMock, std::move(metrics),
+            reportFactoryMock, true, std::make_unique<ClockFake>(),
+            Readings{});
+    }
+
+    ~ReportContext()
+    {
+        sut = nullptr;
+        DbusEnvironment::synchronizeIoc();
+    }
+
+    NiceMock<ReportManagerMock> reportManagerMock;
+    NiceMock<ReportFactoryMock> reportFactoryMock;
+    NiceMock<StorageMock> storageMock;
+    std::unique_ptr<Report> sut;
+};
+
+void reportUpdateReadings(benchmark::State& state)
+{
+    const auto reportUpdates = static_cast<ReportUpdates>(state.range(0));
+    const auto metricCount = static_cast<size_t>(state.range(1));
+    ReportContext ctx(reportUpdates, metricCount, metricCount * 4);
+
+    for (auto _ : state)
+    {
+        ctx.sut->metricUpdated();
+    }
+
+    state.SetLabel(utils::enumToString(reportUpdates));
+    state.SetComplexityN(state.range(1));
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+} // namespace
+
+BENCHMARK(reportUpdateReadings)
+    ->ArgsProduct({{utils::toUnderlying(ReportUpdates::overwrite),
+                    utils::toUnderlying(ReportUpdates::appendWrapsWhenFull)},
+                   benchmark::CreateRange(1, 256, 4)});
@@ -0,0 +1,94 @@
+#include "interfaces/sensor.hpp"
+#include "sensor_cache.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+class SensorStub : public interfaces::Sensor
+{
+  public:
+    explicit SensorStub(Id sensorId) : sensorId(std::move(sensorId)) {}
+
+    static Id makeId(std::string_view service, std::string_view path)
+    {
+        return Id("SensorStub", service, path);
+    }
+
+    Id id() const override
+    {
+        return sensorId;
+    }
+
+    std::string metadata() const override
+    {
+        return {};
+    }
+
+    std::string getName() const override
+    {
+        return {};
+    }
+
+    void registerForUpdates(const std::weak_ptr<interfaces::SensorListener>&)
+        override
+    {}
+
+    void unregisterFromUpdates(
+        const std::weak_ptr<interfaces::SensorListener>&) override
+    {}
+
+    LabeledSensorInfo getLabeledSensorInfo() const override
+    {
+        return {};
+    }
+
+  private:
+    Id sensorId;
+};
+
+std::vector<std::string> makePaths(size_t count)
+{
+    std::vector<std::string> paths;
+    paths.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        paths.emplace_back("/xyz/openbmc_project/sensors/temperature/temp" +
+                           std::to_string(i));
+    }
+    return paths;
+}
+
+// Resolves sensors of a freshly created report with N distinct sensors, while
+// sensors of previously deleted reports are still waiting for expiry.
+void sensorCacheBulkMakeSensor(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto paths = makePaths(count);
+    std::vector<std::shared_ptr<SensorStub>> sensors;
+    sensors.reserve(count);
+
+    SensorCache sut;
+
+    for (auto _ : state)
+    {
+        sensors.clear();
+        for (const auto& path : paths)
+        {
+            sensors.emplace_back(
+                sut.makeSensor<SensorStub>("xyz.openbmc_project.Hwmon", path));
+        }
+        benchmark::DoNotOptimize(sensors.data());
+    }
+
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(sensorCacheBulkMakeSensor)
+    ->RangeMultiplier(4)
+    ->Range(16, 16384)
+    ->Complexity(benchmark::oN);
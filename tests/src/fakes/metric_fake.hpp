@@ -0,0 +1,42 @@
+#pragma once
+
+#include "interfaces/metric.hpp"
+
+class MetricFake : public interfaces::Metric
+{
+  public:
+    explicit MetricFake(std::vector<MetricValue> readingsIn) :
+        readings(std::move(readingsIn))
+    {}
+
+    void initialize() override {}
+    void deinitialize() override {}
+
+    const std::vector<MetricValue>& getUpdatedReadings(
+        const CollectionTimestamp&) override
+    {
+        return readings;
+    }
+
+    LabeledMetricParameters dumpConfiguration() const override
+    {
+        return {};
+    }
+
+    uint64_t metricCount() const override
+    {
+        return readings.size();
+    }
+
+    void registerForUpdates(interfaces::MetricListener&) override {}
+    void unregisterFromUpdates(interfaces::MetricListener&) override {}
+    void updateReadings(Milliseconds) override {}
+
+    bool isTimerRequired() const override
+    {
+        return false;
+    }
+
+  private:
+    std::vector<MetricValue> readings;
+};
@@ -7,11 +7,34 @@
 class StorageMock : public interfaces::JsonStorage
 {
   public:
+    StorageMock()
+    {
+        using namespace testing;
+
+        ON_CALL(*this, storeSerialized(_, _))
+            .WillByDefault([this](const FilePath& path, std::string_view data) {
+                store(path, nlohmann::json::parse(data));
+            });
+        ON_CALL(*this, loadSerialized(_))
+            .WillByDefault(
+                [this](const FilePath& path) -> std::optional<std::string> {
+                    if (auto data = load(path))
+                    {
+                        return data->dump();
+                    }
+                    return std::nullopt;
+                });
+    }
+
     MOCK_METHOD(void, store, (const FilePath&, const nlohmann::json&),
                 (override));
+    MOCK_METHOD(void, storeSerialized, (const FilePath&, std::string_view),
+                (override));
     MOCK_METHOD(bool, remove, (const FilePath&), (override));
     MOCK_METHOD(bool, exist, (const FilePath&), (const, override));
     MOCK_METHOD(std::optional<nlohmann::json>, load, (const FilePath&),
                 (const, override));
+    MOCK_METHOD(std::optional<std::string>, loadSerialized, (const FilePath&),
+                (const, override));
     MOCK_METHOD(std::vector<FilePath>, list, (), (const, override));
 };
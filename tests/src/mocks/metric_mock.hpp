@@ -11,17 +11,17 @@ class MetricMock : public interfaces::Metric
     {
         using namespace testing;
 
-        ON_CALL(*this, getUpdatedReadings())
+        ON_CALL(*this, getUpdatedReadings(_))
             .WillByDefault(ReturnRefOfCopy(std::vector<MetricValue>()));
         ON_CALL(*this, metricCount).WillByDefault(InvokeWithoutArgs([this] {
-            return getUpdatedReadings().size();
+            return getUpdatedReadings(CollectionTimestamp{}).size();
         }));
     }
 
     MOCK_METHOD(void, initialize, (), (override));
     MOCK_METHOD(void, deinitialize, (), (override));
-    MOCK_METHOD(const std::vector<MetricValue>&, getUpdatedReadings, (),
-                (override));
+    MOCK_METHOD(const std::vector<MetricValue>&, getUpdatedReadings,
+                (const CollectionTimestamp&), (override));
     MOCK_METHOD(LabeledMetricParameters, dumpConfiguration, (),
                 (const, override));
     MOCK_METHOD(uint64_t, metricCount, (), (const, override));
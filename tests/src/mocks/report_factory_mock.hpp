@@ -64,6 +64,17 @@ class ReportFactoryMock : public interfaces::ReportFactory
                  bool, Readings),
                 (const, override));
 
+    MOCK_METHOD(std::unique_ptr<history::Store>, makeHistory,
+                (const std::string&), (const, override));
+
+    MOCK_METHOD(void, removeStaleHistory, (const std::vector<std::string>&),
+                (const, override));
+
+    MOCK_METHOD(std::unique_ptr<history::Rollup>, makeRollup, (),
+                (const, override));
+
+    MOCK_METHOD(bool, compressReadings, (), (const, override));
+
     auto& expectMake(
         std::optional<std::reference_wrapper<const ReportParams>> paramsRef,
         const testing::Matcher<interfaces::ReportManager&>& rm,
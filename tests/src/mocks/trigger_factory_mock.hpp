@@ -54,6 +54,9 @@ class TriggerFactoryMock : public interfaces::TriggerFactory
                  const std::vector<LabeledSensorInfo>& senorParams),
                 (const, override));
 
+    MOCK_METHOD(EventLogCounters, getEventLogCounters, (),
+                (const, override));
+
     auto& expectMake(
         std::optional<TriggerParams> paramsOpt,
         const testing::Matcher<interfaces::TriggerManager&>& tm,
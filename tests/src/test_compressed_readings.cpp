@@ -0,0 +1,79 @@
+#include "helpers.hpp"
+#include "utils/circular_vector.hpp"
+#include "utils/compressed_readings.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+class TestCompressedReadings : public TestWithParam<size_t>
+{
+  public:
+    void emplace(const std::string& metricId, double value, uint64_t timestamp)
+    {
+        sut.emplace(metricId, value, timestamp);
+        expectedBuffer.emplace(metricId, value, timestamp);
+    }
+
+    utils::CompressedReadings sut{GetParam()};
+    std::vector<ReadingData> expected;
+    CircularVector<ReadingData> expectedBuffer{expected, GetParam()};
+};
+
+INSTANTIATE_TEST_SUITE_P(_, TestCompressedReadings,
+                         Values(0u, 1u, 5u, 64u, 1000u));
+
+TEST_P(TestCompressedReadings, decodesSameReadingsAsCircularVector)
+{
+    std::mt19937_64 random(GetParam());
+    std::uniform_real_distribution<double> values(-1000.0, 1000.0);
+    std::uniform_int_distribution<uint64_t> jitter(0u, 5000u);
+
+    uint64_t timestamp = 1700000000000u;
+    for (size_t update = 0; update < 300; ++update)
+    {
+        timestamp += update % 50 == 0 ? jitter(random) : 1000u;
+        emplace("temperature", std::floor(values(random)), timestamp);
+        emplace("power", values(random), timestamp + update % 3);
+        emplace("fan", 1200.0, timestamp);
+        if (update % 7 == 0)
+        {
+            emplace("rare", std::numeric_limits<double>::infinity(),
+                    timestamp - 10);
+        }
+
+        ASSERT_THAT(sut.isFull(), Eq(expectedBuffer.isFull()));
+    }
+
+    EXPECT_THAT(sut.decode(), ElementsAreArray(expected));
+}
+
+TEST_P(TestCompressedReadings, clearRemovesReadings)
+{
+    emplace("metric", 1.0, 10u);
+
+    sut.clear();
+
+    EXPECT_THAT(sut.decode(), IsEmpty());
+    EXPECT_THAT(sut.isFull(), Eq(GetParam() == 0u));
+}
+
+TEST(TestCompressedReadingsSize, storesSteadyReadingsCompactly)
+{
+    utils::CompressedReadings sut{10000u};
+
+    for (uint64_t timestamp = 0; timestamp < 1000000u; timestamp += 1000u)
+    {
+        for (const char* metricId : {"a", "b", "c", "d", "e"})
+        {
+            sut.emplace(metricId, 42.5, timestamp);
+        }
+    }
+
+    EXPECT_THAT(sut.decode(), SizeIs(5000u));
+    EXPECT_THAT(sut.encodedSize(), Lt(5000u * sizeof(ReadingData) / 20));
+}
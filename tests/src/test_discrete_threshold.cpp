@@ -22,6 +22,7 @@ class TestDiscreteThreshold : public Test
     std::unique_ptr<TriggerActionMock> actionMockPtr =
         std::make_unique<StrictMock<TriggerActionMock>>();
     TriggerActionMock& actionMock = *actionMockPtr;
+    utils::TimerWheel timerWheel{DbusEnvironment::getIoc()};
     std::shared_ptr<DiscreteThreshold> sut;
     std::string triggerId = "MyTrigger";
     std::unique_ptr<NiceMock<ClockMock>> clockMockPtr =
@@ -36,7 +37,7 @@ class TestDiscreteThreshold : public Test
         actions.push_back(std::move(actionMockPtr));
 
         return std::make_shared<DiscreteThreshold>(
-            DbusEnvironment::getIoc(), triggerId,
+            timerWheel, triggerId,
             utils::convContainer<std::shared_ptr<interfaces::Sensor>>(
                 sensorMocks),
             std::move(actions), dwellTime, thresholdValue, thresholdName,
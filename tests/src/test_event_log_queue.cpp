@@ -0,0 +1,92 @@
+#include "dbus_environment.hpp"
+#include "event_log_queue.hpp"
+#include "fakes/clock_fake.hpp"
+#include "helpers.hpp"
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+class TestEventLogQueue : public Test
+{
+  public:
+    std::unique_ptr<ClockFake> clockFakePtr = std::make_unique<ClockFake>();
+    ClockFake& clockFake = *clockFakePtr;
+    EventLogQueue sut{DbusEnvironment::getIoc(),
+                      EventLogQueue::Limits{.capacity = 8,
+                                            .eventsPerWindow = 3,
+                                            .window = 1000ms,
+                                            .flushInterval = 10ms},
+                      std::move(clockFakePtr)};
+
+    void push(const std::string& triggerId, const std::string& sensorName)
+    {
+        sut.push("Message.", "Telemetry.1.0.TriggerDiscreteConditionMet",
+                 triggerId, sensorName, sensorName + ",On," + triggerId);
+    }
+};
+
+TEST_F(TestEventLogQueue, pushedEventsAreLoggedInBatchAfterFlushInterval)
+{
+    push("Trigger1", "Sensor1");
+    push("Trigger1", "Sensor2");
+
+    EXPECT_THAT(sut.getCounters().logged, Eq(0u));
+
+    DbusEnvironment::sleepFor(50ms);
+
+    EXPECT_THAT(sut.size(), Eq(0u));
+    EXPECT_THAT(sut.getCounters().logged, Eq(2u));
+}
+
+TEST_F(TestEventLogQueue, suppressesEventsAboveRateOfTriggerAndSensor)
+{
+    for (size_t i = 0; i < 5; ++i)
+    {
+        push("Trigger1", "Sensor1");
+    }
+    push("Trigger2", "Sensor1");
+
+    EXPECT_THAT(sut.size(), Eq(4u));
+    EXPECT_THAT(sut.getCounters().suppressed, Eq(2u));
+}
+
+TEST_F(TestEventLogQueue, logsSummaryOfSuppressedEventsAfterWindow)
+{
+    for (size_t i = 0; i < 5; ++i)
+    {
+        push("Trigger1", "Sensor1");
+    }
+    sut.flush();
+
+    clockFake.advance(1000ms);
+    sut.flush();
+
+    EXPECT_THAT(sut.getCounters().logged, Eq(4u));
+    EXPECT_THAT(sut.getCounters().suppressed, Eq(2u));
+}
+
+TEST_F(TestEventLogQueue, startsNewWindowAfterWindowElapses)
+{
+    for (size_t i = 0; i < 3; ++i)
+    {
+        push("Trigger1", "Sensor1");
+    }
+    clockFake.advance(1000ms);
+    push("Trigger1", "Sensor1");
+
+    EXPECT_THAT(sut.size(), Eq(4u));
+    EXPECT_THAT(sut.getCounters().suppressed, Eq(0u));
+}
+
+TEST_F(TestEventLogQueue, dropsEventsWhenQueueIsFull)
+{
+    for (size_t i = 0; i < 10; ++i)
+    {
+        push("Trigger1", "Sensor" + std::to_string(i));
+    }
+
+    EXPECT_THAT(sut.size(), Eq(8u));
+    EXPECT_THAT(sut.getCounters().dropped, Eq(2u));
+}
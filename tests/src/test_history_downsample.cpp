@@ -0,0 +1,70 @@
+#include "helpers.hpp"
+#include "history/downsample.hpp"
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+class TestHistoryDownsample : public Test
+{
+  public:
+    static std::vector<ReadingData> downsample(
+        const std::vector<ReadingData>& readings, size_t maxPoints)
+    {
+        history::Downsampler sut(maxPoints);
+        for (const auto& [metricId, value, timestamp] : readings)
+        {
+            sut.add(metricId, value, timestamp);
+        }
+        return sut.finish();
+    }
+};
+
+TEST_F(TestHistoryDownsample, keepsReadingsWithinLimit)
+{
+    const std::vector<ReadingData> readings = {
+        {"b", 1.0, 1u}, {"a", 2.0, 2u}, {"a", 3.0, 3u}, {"a", 4.0, 4u}};
+
+    EXPECT_THAT(downsample(readings, 4u), Eq(readings));
+}
+
+TEST_F(TestHistoryDownsample, averagesBucketsOfEachMetric)
+{
+    const std::vector<ReadingData> readings = {
+        {"a", 1.0, 1u}, {"b", 10.0, 1u}, {"a", 3.0, 2u},
+        {"b", 20.0, 2u}, {"a", 5.0, 3u}, {"b", 30.0, 3u},
+        {"a", 7.0, 4u}, {"b", 40.0, 4u}};
+
+    EXPECT_THAT(downsample(readings, 4u),
+                ElementsAre(ReadingData{"a", 2.0, 2u},
+                            ReadingData{"b", 15.0, 2u},
+                            ReadingData{"a", 6.0, 4u},
+                            ReadingData{"b", 35.0, 4u}));
+}
+
+TEST_F(TestHistoryDownsample, neverReturnsMoreThanMaxPoints)
+{
+    std::vector<ReadingData> readings;
+    for (uint64_t timestamp = 0; timestamp < 1000; ++timestamp)
+    {
+        for (const char* metricId : {"a", "b", "c"})
+        {
+            readings.emplace_back(metricId, 1.0, timestamp);
+        }
+    }
+
+    for (size_t maxPoints : {1u, 2u, 3u, 7u, 100u})
+    {
+        EXPECT_THAT(downsample(readings, maxPoints), SizeIs(Le(maxPoints)));
+    }
+}
+
+TEST_F(TestHistoryDownsample, keepsFirstMetricsWhenLimitIsTooLow)
+{
+    const std::vector<ReadingData> readings = {
+        {"c", 3.0, 1u}, {"b", 2.0, 1u}, {"a", 1.0, 2u}};
+
+    EXPECT_THAT(downsample(readings, 2u),
+                ElementsAre(ReadingData{"b", 2.0, 1u},
+                            ReadingData{"a", 1.0, 2u}));
+}
@@ -0,0 +1,75 @@
+#include "helpers.hpp"
+#include "history/rollup.hpp"
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace std::chrono_literals;
+using namespace std::string_literals;
+
+class TestHistoryRollup : public Test
+{
+  public:
+    history::Rollup sut{
+        {{.resolution = Milliseconds(1000), .retention = Milliseconds(3000)},
+         {.resolution = Milliseconds(10000),
+          .retention = Milliseconds(100000)}}};
+};
+
+TEST_F(TestHistoryRollup, returnsNulloptForUnknownResolution)
+{
+    EXPECT_THAT(sut.read(Milliseconds(500), 0u, 100000u), Eq(std::nullopt));
+}
+
+TEST_F(TestHistoryRollup, keepsOpenBucketOutOfResults)
+{
+    sut.add("metric", 1.0, 100u);
+    sut.add("metric", 3.0, 600u);
+
+    EXPECT_THAT(sut.read(Milliseconds(1000), 0u, 100000u),
+                Optional(IsEmpty()));
+}
+
+TEST_F(TestHistoryRollup, computesMinAvgMaxOfClosedBuckets)
+{
+    sut.add("metric", 1.0, 0u);
+    sut.add("metric", 3.0, 500u);
+    sut.add("metric", 5.0, 1000u);
+
+    EXPECT_THAT(
+        sut.read(Milliseconds(1000), 0u, 100000u),
+        Optional(ElementsAre(history::RollupReading{"metric", 0u, 1.0, 2.0,
+                                                    3.0})));
+}
+
+TEST_F(TestHistoryRollup, keepsMetricsInSeparateSeries)
+{
+    sut.add("a", 1.0, 0u);
+    sut.add("b", 10.0, 0u);
+    sut.add("a", 2.0, 1000u);
+    sut.add("b", 20.0, 1000u);
+
+    EXPECT_THAT(
+        sut.read(Milliseconds(1000), 0u, 100000u),
+        Optional(ElementsAre(history::RollupReading{"a", 0u, 1.0, 1.0, 1.0},
+                             history::RollupReading{"b", 0u, 10.0, 10.0,
+                                                    10.0})));
+}
+
+TEST_F(TestHistoryRollup, appliesRetentionPerTier)
+{
+    for (uint64_t timestamp = 0; timestamp <= 20000; timestamp += 1000)
+    {
+        sut.add("metric", static_cast<double>(timestamp), timestamp);
+    }
+
+    EXPECT_THAT(sut.read(Milliseconds(1000), 0u, 100000u),
+                Optional(ElementsAre(FieldsAre("metric"s, 17000u, _, _, _),
+                                     FieldsAre("metric"s, 18000u, _, _, _),
+                                     FieldsAre("metric"s, 19000u, _, _, _))));
+    EXPECT_THAT(sut.read(Milliseconds(10000), 0u, 100000u),
+                Optional(ElementsAre(
+                    history::RollupReading{"metric", 0u, 0.0, 4500.0, 9000.0},
+                    history::RollupReading{"metric", 10000u, 10000.0, 14500.0,
+                                           19000.0})));
+}
@@ -0,0 +1,210 @@
+#include "helpers.hpp"
+#include "history/store.hpp"
+
+#include <fstream>
+#include <limits>
+#include <span>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+class TestHistoryStore : public Test
+{
+  public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_FALSE(std::filesystem::exists(directory));
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    std::unique_ptr<history::Store> makeStore(history::Store::Limits limits)
+    {
+        return std::make_unique<history::Store>(directory, limits);
+    }
+
+    static std::vector<ReadingData> read(const history::Store& store,
+                                         uint64_t start, uint64_t end)
+    {
+        std::vector<ReadingData> result;
+        store.read(start, end, [&result](std::span<const ReadingData> block) {
+            result.insert(result.end(), block.begin(), block.end());
+        });
+        return result;
+    }
+
+    static size_t segmentCount()
+    {
+        size_t count = 0;
+        for ([[maybe_unused]] const auto& entry :
+             std::filesystem::directory_iterator(directory))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    static const std::filesystem::path directory;
+    history::Store::Limits limits{.maxSize = 1024 * 1024,
+                                  .maxAge = Milliseconds(1h),
+                                  .segmentSize = 64 * 1024,
+                                  .flushTicks = 1};
+};
+
+const std::filesystem::path TestHistoryStore::directory =
+    std::filesystem::temp_directory_path() / "telemetry-history-tests";
+
+TEST_F(TestHistoryStore, readsBackFlushedReadings)
+{
+    const std::vector<ReadingData> readings = {
+        {"metric1", 1.5, 1000u},
+        {"metric2", std::numeric_limits<double>::infinity(), 1000u},
+        {"metric1", 1.5, 2000u},
+        {"metric1", -2.25, 3000u}};
+
+    auto sut = makeStore(limits);
+    for (const auto& [id, value, timestamp] : readings)
+    {
+        sut->append(id, value, timestamp);
+    }
+    sut->tick();
+
+    EXPECT_THAT(read(*sut, 0u, 5000u), ElementsAreArray(readings));
+    EXPECT_THAT(read(*sut, 1500u, 2500u),
+                ElementsAre(ReadingData{"metric1", 1.5, 2000u}));
+}
+
+TEST_F(TestHistoryStore, readsRangeSpanningSeveralBlocks)
+{
+    auto sut = makeStore(limits);
+    for (uint64_t i = 0; i < 10; ++i)
+    {
+        sut->append("metric", static_cast<double>(i), i * 100);
+        sut->tick();
+    }
+
+    EXPECT_THAT(read(*sut, 250u, 450u),
+                ElementsAre(ReadingData{"metric", 3.0, 300u},
+                            ReadingData{"metric", 4.0, 400u}));
+    EXPECT_THAT(segmentCount(), Eq(1u));
+}
+
+TEST_F(TestHistoryStore, passesReadingsOneBlockAtATime)
+{
+    limits.flushTicks = 2;
+    auto sut = makeStore(limits);
+    for (uint64_t i = 0; i < 5; ++i)
+    {
+        sut->append("metric", static_cast<double>(i), i * 100);
+        sut->tick();
+    }
+
+    std::vector<size_t> blockSizes;
+    sut->read(0u, 1000u, [&blockSizes](std::span<const ReadingData> block) {
+        blockSizes.emplace_back(block.size());
+    });
+
+    EXPECT_THAT(blockSizes, ElementsAre(2u, 2u, 1u));
+}
+
+TEST_F(TestHistoryStore, keepsReadingsAcrossRestart)
+{
+    makeStore(limits)->append("metric", 7.0, 100u);
+
+    auto sut = makeStore(limits);
+    sut->append("metric", 8.0, 200u);
+    sut->flush();
+
+    EXPECT_THAT(read(*sut, 0u, 1000u),
+                ElementsAre(ReadingData{"metric", 7.0, 100u},
+                            ReadingData{"metric", 8.0, 200u}));
+    EXPECT_THAT(segmentCount(), Eq(2u));
+}
+
+TEST_F(TestHistoryStore, batchesWritesUntilFlushTicksPass)
+{
+    limits.flushTicks = 3;
+    auto sut = makeStore(limits);
+
+    sut->append("metric", 1.0, 1u);
+    sut->tick();
+    sut->append("metric", 2.0, 2u);
+    sut->tick();
+
+    EXPECT_THAT(sut->diskUsage(), Eq(0u));
+    EXPECT_THAT(read(*sut, 0u, 10u), SizeIs(2u));
+
+    sut->tick();
+
+    EXPECT_THAT(sut->diskUsage(), Gt(0u));
+    EXPECT_THAT(read(*sut, 0u, 10u), SizeIs(2u));
+}
+
+TEST_F(TestHistoryStore, dropsOldestSegmentsOverSizeLimit)
+{
+    limits.segmentSize = 1;
+    limits.maxSize = 300;
+    auto sut = makeStore(limits);
+
+    for (uint64_t i = 0; i < 20; ++i)
+    {
+        sut->append("metric", static_cast<double>(i), i);
+        sut->tick();
+    }
+
+    EXPECT_THAT(sut->diskUsage(), Le(limits.maxSize));
+    EXPECT_THAT(read(*sut, 19u, 19u),
+                ElementsAre(ReadingData{"metric", 19.0, 19u}));
+    EXPECT_THAT(read(*sut, 0u, 0u), IsEmpty());
+}
+
+TEST_F(TestHistoryStore, dropsSegmentsOlderThanMaxAge)
+{
+    limits.segmentSize = 1;
+    limits.maxAge = Milliseconds(100);
+    auto sut = makeStore(limits);
+
+    sut->append("metric", 1.0, 1000u);
+    sut->tick();
+    sut->append("metric", 2.0, 1050u);
+    sut->tick();
+    sut->append("metric", 3.0, 1200u);
+    sut->tick();
+
+    EXPECT_THAT(read(*sut, 0u, 2000u),
+                ElementsAre(ReadingData{"metric", 3.0, 1200u}));
+}
+
+TEST_F(TestHistoryStore, skipsTornBlockAfterPowerLoss)
+{
+    makeStore(limits)->append("metric", 1.0, 10u);
+
+    const auto segment =
+        std::filesystem::directory_iterator(directory)->path();
+    std::ofstream(segment, std::ios::app | std::ios::binary) << "TLHB\x10";
+
+    auto sut = makeStore(limits);
+    sut->append("metric", 2.0, 20u);
+    sut->flush();
+
+    EXPECT_THAT(read(*sut, 0u, 100u),
+                ElementsAre(ReadingData{"metric", 1.0, 10u},
+                            ReadingData{"metric", 2.0, 20u}));
+}
+
+TEST_F(TestHistoryStore, removeDeletesStoredData)
+{
+    auto sut = makeStore(limits);
+    sut->append("metric", 1.0, 1u);
+    sut->flush();
+
+    sut->remove();
+
+    EXPECT_FALSE(std::filesystem::exists(directory));
+    EXPECT_THAT(read(*sut, 0u, 10u), IsEmpty());
+}
@@ -0,0 +1,137 @@
+#include "dbus_environment.hpp"
+#include "helpers.hpp"
+#include "hwmon_scheduler.hpp"
+#include "hwmon_sensor.hpp"
+#include "mocks/sensor_listener_mock.hpp"
+#include "sensor_cache.hpp"
+#include "utils/clock.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+class TestHwmonSensor : public Test
+{
+  public:
+    void SetUp() override
+    {
+        writeAttribute("temp1_input", "42500\n");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(sysfsRoot);
+    }
+
+    void writeAttribute(const std::string& name, const std::string& content)
+    {
+        std::filesystem::create_directories(sysfsRoot / hwmonDir);
+        std::ofstream(sysfsRoot / hwmonDir / name) << content;
+    }
+
+    std::shared_ptr<HwmonSensor> makeSensor(const std::string& name)
+    {
+        return sensorCache.makeSensor<HwmonSensor>(
+            HwmonScheduler::service, "/" + hwmonDir + "/" + name, "metadata",
+            scheduler);
+    }
+
+    const std::filesystem::path sysfsRoot =
+        std::filesystem::temp_directory_path() / "telemetry-tests-hwmon";
+    const std::string hwmonDir = "sys/class/hwmon/hwmon0";
+
+    HwmonScheduler scheduler{DbusEnvironment::getIoc(), 10ms, sysfsRoot};
+    SensorCache sensorCache;
+    Milliseconds timestamp = Clock().steadyTimestamp();
+    std::shared_ptr<HwmonSensor> sut = makeSensor("temp1_input");
+    std::shared_ptr<SensorListenerMock> listenerMock =
+        std::make_shared<StrictMock<SensorListenerMock>>();
+};
+
+TEST_F(TestHwmonSensor, recognizesHwmonPaths)
+{
+    EXPECT_THAT(HwmonScheduler::isHwmonPath(
+                    "/sys/class/hwmon/hwmon0/temp1_input"),
+                Eq(true));
+    EXPECT_THAT(HwmonScheduler::isHwmonPath("/xyz/openbmc_project/sensors"),
+                Eq(false));
+}
+
+TEST_F(TestHwmonSensor, acceptsOnlyExistingInputAttributes)
+{
+    writeAttribute("temp1_max", "90000\n");
+
+    EXPECT_THAT(scheduler.isReadable("/" + hwmonDir + "/temp1_input"),
+                Eq(true));
+    EXPECT_THAT(scheduler.isReadable("/" + hwmonDir + "/temp1_max"),
+                Eq(false));
+    EXPECT_THAT(scheduler.isReadable("/" + hwmonDir + "/temp2_input"),
+                Eq(false));
+}
+
+TEST_F(TestHwmonSensor, scalesPerHwmonConventions)
+{
+    EXPECT_THAT(HwmonScheduler::scaleFor("/a/temp1_input"), DoubleEq(1e-3));
+    EXPECT_THAT(HwmonScheduler::scaleFor("/a/in0_input"), DoubleEq(1e-3));
+    EXPECT_THAT(HwmonScheduler::scaleFor("/a/curr1_input"), DoubleEq(1e-3));
+    EXPECT_THAT(HwmonScheduler::scaleFor("/a/power1_input"), DoubleEq(1e-6));
+    EXPECT_THAT(HwmonScheduler::scaleFor("/a/energy1_input"), DoubleEq(1e-6));
+    EXPECT_THAT(HwmonScheduler::scaleFor("/a/fan1_input"), DoubleEq(1.0));
+}
+
+TEST_F(TestHwmonSensor, notifiesWithScaledValueAfterRegister)
+{
+    EXPECT_CALL(*listenerMock,
+                sensorUpdated(Ref(*sut), Ge(timestamp), DoubleEq(42.5)));
+
+    sut->registerForUpdates(listenerMock);
+}
+
+TEST_F(TestHwmonSensor, notifiesOnChangeWhenPolled)
+{
+    InSequence seq;
+    EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, DoubleEq(42.5)));
+    EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, DoubleEq(-1.25)));
+
+    sut->registerForUpdates(listenerMock);
+    scheduler.poll();
+    writeAttribute("temp1_input", "-1250\n");
+    scheduler.poll();
+}
+
+TEST_F(TestHwmonSensor, notifiesFromSchedulerTimer)
+{
+    EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, DoubleEq(42.5)));
+    EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, DoubleEq(7.0)))
+        .WillOnce(InvokeWithoutArgs(DbusEnvironment::setPromise("poll")));
+
+    sut->registerForUpdates(listenerMock);
+    writeAttribute("temp1_input", "7000\n");
+
+    ASSERT_TRUE(DbusEnvironment::waitForFuture("poll"));
+}
+
+TEST_F(TestHwmonSensor, stopsNotifyingAfterUnregister)
+{
+    EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, DoubleEq(42.5)));
+
+    sut->registerForUpdates(listenerMock);
+    sut->unregisterFromUpdates(listenerMock);
+    writeAttribute("temp1_input", "7000\n");
+    scheduler.poll();
+}
+
+TEST_F(TestHwmonSensor, recoversWhenAttributeBecomesReadable)
+{
+    std::filesystem::remove(sysfsRoot / hwmonDir / "temp1_input");
+
+    EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, DoubleEq(3.0)));
+
+    sut->registerForUpdates(listenerMock);
+    writeAttribute("temp1_input", "3000\n");
+    scheduler.poll();
+}
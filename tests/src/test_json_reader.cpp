@@ -0,0 +1,81 @@
+#include "helpers.hpp"
+#include "utils/json_reader.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+TEST(TestJsonReader, readsIntegersWrittenAsDoubles)
+{
+    EXPECT_THAT(utils::JsonReader("1e3").readInt64(), Eq(1000));
+    EXPECT_THAT(utils::JsonReader("-2.0").readInt64(), Eq(-2));
+    EXPECT_THAT(utils::JsonReader("4.0").readUint64(), Eq(4u));
+}
+
+TEST(TestJsonReader, readsIntegerLimits)
+{
+    EXPECT_THAT(utils::JsonReader("-9223372036854775808").readInt64(),
+                Eq(std::numeric_limits<int64_t>::min()));
+    EXPECT_THAT(utils::JsonReader("18446744073709551615").readUint64(),
+                Eq(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(TestJsonReader, throwsWhenIntegerIsNotExact)
+{
+    EXPECT_THROW(utils::JsonReader("1.5").readInt64(), std::runtime_error);
+    EXPECT_THROW(utils::JsonReader("0.5").readUint64(), std::runtime_error);
+}
+
+TEST(TestJsonReader, throwsWhenIntegerIsOutOfRange)
+{
+    EXPECT_THROW(utils::JsonReader("9223372036854775808").readInt64(),
+                 std::runtime_error);
+    EXPECT_THROW(utils::JsonReader("1e300").readInt64(), std::runtime_error);
+    EXPECT_THROW(utils::JsonReader("18446744073709551616").readUint64(),
+                 std::runtime_error);
+    EXPECT_THROW(utils::JsonReader("-1").readUint64(), std::runtime_error);
+}
+
+TEST(TestJsonReader, throwsWhenIntegerIsNarrowed)
+{
+    EXPECT_THAT(utils::JsonReader("4294967295").read<uint32_t>(),
+                Eq(std::numeric_limits<uint32_t>::max()));
+    EXPECT_THROW(utils::JsonReader("4294967296").read<uint32_t>(),
+                 std::runtime_error);
+    EXPECT_THROW(utils::JsonReader("-129").read<int8_t>(), std::runtime_error);
+}
+
+TEST(TestJsonReader, throwsOnUnknownNumericLiteral)
+{
+    EXPECT_THAT(utils::JsonReader(R"("-inf")").readDouble(),
+                Eq(-std::numeric_limits<double>::infinity()));
+    EXPECT_THROW(utils::JsonReader(R"("FooBar")").readDouble(),
+                 std::runtime_error);
+}
+
+TEST(TestJsonReader, decodesSurrogatePairs)
+{
+    std::string item;
+    utils::JsonReader(R"("\ud83d\ude00")").readString(item);
+
+    EXPECT_THAT(item, Eq("\xf0\x9f\x98\x80"));
+}
+
+TEST(TestJsonReader, throwsOnInvalidSurrogates)
+{
+    std::string item;
+
+    EXPECT_THROW(utils::JsonReader(R"("\ud83d")").readString(item),
+                 std::runtime_error);
+    EXPECT_THROW(utils::JsonReader(R"("\ud83dx")").readString(item),
+                 std::runtime_error);
+    EXPECT_THROW(utils::JsonReader(R"("\ud83d\u0041")").readString(item),
+                 std::runtime_error);
+    EXPECT_THROW(utils::JsonReader(R"("\ude00")").readString(item),
+                 std::runtime_error);
+}
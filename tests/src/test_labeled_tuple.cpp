@@ -2,6 +2,7 @@
 #include "utils/labeled_tuple.hpp"
 
 #include <limits>
+#include <stdexcept>
 
 #include <gmock/gmock.h>
 
@@ -81,3 +82,78 @@ TEST(TestLabeledTupleDoubleSpecializationNegative,
 
     EXPECT_THROW(data.get<LabeledTestingTuple>(), std::invalid_argument);
 }
+
+class TestLabeledTupleStreaming : public Test
+{
+  public:
+    std::string serialize(const LabeledTestingTuple& tuple)
+    {
+        std::string result;
+        utils::JsonWriter writer(result);
+        writer.write(tuple);
+        return result;
+    }
+};
+
+TEST_F(TestLabeledTupleStreaming, writesSameJsonAsDomSerializer)
+{
+    for (double value : {10.5, 42.0, std::numeric_limits<double>::infinity(),
+                         std::numeric_limits<double>::quiet_NaN()})
+    {
+        LabeledTestingTuple tuple(value, "Some \"quoted\"\n value");
+
+        EXPECT_THAT(nlohmann::json::parse(serialize(tuple)),
+                    Eq(nlohmann::json(tuple)));
+    }
+}
+
+TEST_F(TestLabeledTupleStreaming, readsJsonWrittenByDomSerializer)
+{
+    LabeledTestingTuple initial(-std::numeric_limits<double>::infinity(),
+                                "Value \u00e9");
+    utils::JsonReader reader(nlohmann::json(initial).dump());
+
+    LabeledTestingTuple deserialized;
+    reader.read(deserialized);
+    reader.end();
+
+    EXPECT_THAT(deserialized, Eq(initial));
+}
+
+TEST_F(TestLabeledTupleStreaming, readsVectorOfTuples)
+{
+    std::vector<LabeledTestingTuple> initial = {
+        LabeledTestingTuple(1.5, "first"), LabeledTestingTuple(2.5, "second")};
+    std::string data;
+    utils::JsonWriter writer(data);
+    writer.write(initial);
+
+    utils::JsonReader reader(data);
+    auto deserialized = reader.read<std::vector<LabeledTestingTuple>>();
+
+    EXPECT_THAT(deserialized, ElementsAreArray(initial));
+}
+
+TEST_F(TestLabeledTupleStreaming, ignoresUnknownKeys)
+{
+    utils::JsonReader reader(
+        R"({"Extra":{"a":[1,2]},"StringValue":"x","DoubleValue":1})");
+
+    auto deserialized = reader.read<LabeledTestingTuple>();
+
+    EXPECT_THAT(deserialized, Eq(LabeledTestingTuple(1.0, "x")));
+}
+
+TEST_F(TestLabeledTupleStreaming, throwsWhenLabelIsMissing)
+{
+    utils::JsonReader reader(R"({"DoubleValue":1.0})");
+
+    EXPECT_THROW(reader.read<LabeledTestingTuple>(), std::out_of_range);
+}
+
+TEST_F(TestLabeledTupleStreaming, throwsOnMalformedJson)
+{
+    utils::JsonReader reader(R"({"DoubleValue":1.0 "StringValue":"x"})");
+
+    EXPECT_THROW(reader.read<LabeledTestingTuple>(), std::runtime_error);
+}
@@ -45,8 +45,13 @@ class TestMetric : public Test
         return std::make_shared<Metric>(
             utils::convContainer<std::shared_ptr<interfaces::Sensor>>(
                 sensorMocks),
-            p.operationType(), p.collectionTimeScope(), p.collectionDuration(),
-            std::move(clockFakePtr));
+            p.operationType(), p.collectionTimeScope(), p.collectionDuration());
+    }
+
+    CollectionTimestamp now() const
+    {
+        return {.steady = clockFake.steadyTimestamp(),
+                .system = clockFake.systemTimestamp()};
     }
 
     MetricParams params = MetricParams()
@@ -54,8 +59,7 @@ class TestMetric : public Test
                               .collectionTimeScope(CollectionTimeScope::point)
                               .collectionDuration(CollectionDuration(0ms));
     std::vector<std::shared_ptr<SensorMock>> sensorMocks = makeSensorMocks(1u);
-    std::unique_ptr<ClockFake> clockFakePtr = std::make_unique<ClockFake>();
-    ClockFake& clockFake = *clockFakePtr;
+    ClockFake clockFake;
     NiceMock<MetricListenerMock> listenerMock;
     std::shared_ptr<Metric> sut;
 };
@@ -88,7 +92,7 @@ TEST_F(TestMetric, containsEmptyReadingAfterCreated)
 {
     sut = makeSut(params);
 
-    ASSERT_THAT(sut->getUpdatedReadings(), ElementsAre());
+    ASSERT_THAT(sut->getUpdatedReadings(now()), ElementsAre());
 }
 
 TEST_F(TestMetric,
@@ -131,7 +135,7 @@ class TestMetricAfterInitialization : public TestMetric
 
 TEST_F(TestMetricAfterInitialization, containsEmptyReading)
 {
-    ASSERT_THAT(sut->getUpdatedReadings(), ElementsAre());
+    ASSERT_THAT(sut->getUpdatedReadings(now()), ElementsAre());
 }
 
 TEST_F(TestMetricAfterInitialization, updatesMetricValuesOnSensorUpdate)
@@ -139,7 +143,7 @@ TEST_F(TestMetricAfterInitialization, updatesMetricValuesOnSensorUpdate)
     sut->sensorUpdated(*sensorMocks.front(), Milliseconds{18}, 31.2);
 
     ASSERT_THAT(
-        sut->getUpdatedReadings(),
+        sut->getUpdatedReadings(now()),
         ElementsAre(MetricValue{"metadata0", 31.2,
                                 std::chrono::duration_cast<Milliseconds>(
                                     clockFake.system.timestamp())
@@ -355,7 +359,7 @@ TEST_P(TestMetricCalculationFunctions, calculatesReadingValue)
 
     const auto [expectedTimestamp, expectedReading] =
         GetParam().expectedReading();
-    const auto readings = sut->getUpdatedReadings();
+    const auto readings = sut->getUpdatedReadings(now());
 
     EXPECT_THAT(readings, ElementsAre(MetricValue{"metadata0", expectedReading,
                                                   expectedTimestamp.count()}));
@@ -369,12 +373,12 @@ TEST_P(TestMetricCalculationFunctions,
         sut->sensorUpdated(*sensorMocks.front(), clockFake.steadyTimestamp(),
                            reading);
         clockFake.advance(timestamp);
-        sut->getUpdatedReadings();
+        sut->getUpdatedReadings(now());
     }
 
     const auto [expectedTimestamp, expectedReading] =
         GetParam().expectedReading();
-    const auto readings = sut->getUpdatedReadings();
+    const auto readings = sut->getUpdatedReadings(now());
 
     EXPECT_THAT(readings, ElementsAre(MetricValue{"metadata0", expectedReading,
                                                   expectedTimestamp.count()}));
@@ -403,12 +407,12 @@ TEST_F(TestMetricWithMultipleSensors, readingsContainsAllReadingsInOrder)
     for (size_t i = 0; i < sensorMocks.size(); ++i)
     {
         sut->sensorUpdated(*sensorMocks[i], Milliseconds{i + 100}, i + 10.0);
-        sut->getUpdatedReadings();
+        sut->getUpdatedReadings(now());
     }
 
     clockFake.system.set(Milliseconds{72});
 
-    EXPECT_THAT(sut->getUpdatedReadings(),
+    EXPECT_THAT(sut->getUpdatedReadings(now()),
                 ElementsAre(MetricValue{"metadata0", 10.0, 72},
                             MetricValue{"metadata1", 11.0, 72},
                             MetricValue{"metadata2", 12.0, 72},
@@ -423,12 +427,12 @@ TEST_F(TestMetricWithMultipleSensors, readingsContainOnlyAvailableSensors)
     for (auto i : {5u, 3u, 6u, 0u})
     {
         sut->sensorUpdated(*sensorMocks[i], Milliseconds{i + 100}, i + 10.0);
-        sut->getUpdatedReadings();
+        sut->getUpdatedReadings(now());
     }
 
     clockFake.system.set(Milliseconds{62});
 
-    EXPECT_THAT(sut->getUpdatedReadings(),
+    EXPECT_THAT(sut->getUpdatedReadings(now()),
                 ElementsAre(MetricValue{"metadata5", 15.0, 62},
                             MetricValue{"metadata3", 13.0, 62},
                             MetricValue{"metadata6", 16.0, 62},
@@ -440,12 +444,12 @@ TEST_F(TestMetricWithMultipleSensors, readingsContainsAllReadingsOutOfOrder)
     for (auto i : {6u, 5u, 3u, 4u, 0u, 2u, 1u})
     {
         sut->sensorUpdated(*sensorMocks[i], Milliseconds{i + 100}, i + 10.0);
-        sut->getUpdatedReadings();
+        sut->getUpdatedReadings(now());
     }
 
     clockFake.system.set(Milliseconds{52});
 
-    EXPECT_THAT(sut->getUpdatedReadings(),
+    EXPECT_THAT(sut->getUpdatedReadings(now()),
                 ElementsAre(MetricValue{"metadata6", 16.0, 52},
                             MetricValue{"metadata5", 15.0, 52},
                             MetricValue{"metadata3", 13.0, 52},
@@ -0,0 +1,66 @@
+#include "helpers.hpp"
+#include "metric_report_renderer.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+class TestMetricReportRenderer : public Test
+{
+  public:
+    MetricReportRenderer sut{"Report1"};
+};
+
+TEST_F(TestMetricReportRenderer, formatsDateTimeWithMilliseconds)
+{
+    std::string result;
+
+    MetricReportRenderer::appendDateTime(result, 1700000000123u);
+
+    EXPECT_THAT(result, Eq("2023-11-14T22:13:20.123+00:00"));
+}
+
+TEST_F(TestMetricReportRenderer, rendersRedfishMetricReport)
+{
+    sut.render(
+        Readings{1000u, {{"metric1", 1.5, 2000u}, {"m\"2", 4.0, 3000u}}});
+
+    EXPECT_THAT(
+        nlohmann::json::parse(sut.get()),
+        Eq(nlohmann::json{
+            {"@odata.id", "/redfish/v1/TelemetryService/MetricReports/Report1"},
+            {"@odata.type", "#MetricReport.v1_3_0.MetricReport"},
+            {"Id", "Report1"},
+            {"Name", "Report1"},
+            {"MetricReportDefinition",
+             {{"@odata.id", "/redfish/v1/TelemetryService/"
+                            "MetricReportDefinitions/Report1"}}},
+            {"Timestamp", "1970-01-01T00:00:01.000+00:00"},
+            {"MetricValues",
+             {{{"MetricId", "metric1"},
+               {"MetricValue", "1.500000"},
+               {"Timestamp", "1970-01-01T00:00:02.000+00:00"}},
+              {{"MetricId", "m\"2"},
+               {"MetricValue", "4.000000"},
+               {"Timestamp", "1970-01-01T00:00:03.000+00:00"}}}}}));
+}
+
+TEST_F(TestMetricReportRenderer, rendersEmptyReadings)
+{
+    sut.render(Readings{0u, {}});
+
+    EXPECT_THAT(nlohmann::json::parse(sut.get())["MetricValues"],
+                Eq(nlohmann::json::array()));
+}
+
+TEST_F(TestMetricReportRenderer, replacesPreviousReadings)
+{
+    sut.render(Readings{0u, {{"metric1", 1.0, 0u}}});
+    sut.render(Readings{0u, {{"metric2", 2.0, 0u}}});
+
+    const auto json = nlohmann::json::parse(sut.get());
+    ASSERT_THAT(json["MetricValues"].size(), Eq(1u));
+    EXPECT_THAT(json["MetricValues"][0]["MetricId"], Eq("metric2"));
+}
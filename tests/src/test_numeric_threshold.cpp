@@ -4,6 +4,7 @@
 #include "mocks/sensor_mock.hpp"
 #include "mocks/trigger_action_mock.hpp"
 #include "numeric_threshold.hpp"
+#include "numeric_threshold_table.hpp"
 #include "utils/conv_container.hpp"
 
 #include <gmock/gmock.h>
@@ -21,10 +22,12 @@ class TestNumericThreshold : public Test
     std::unique_ptr<TriggerActionMock> actionMockPtr =
         std::make_unique<StrictMock<TriggerActionMock>>();
     TriggerActionMock& actionMock = *actionMockPtr;
+    utils::TimerWheel timerWheel{DbusEnvironment::getIoc()};
     std::shared_ptr<NumericThreshold> sut;
     std::string triggerId = "MyTrigger";
     std::unique_ptr<NiceMock<ClockMock>> clockMockPtr =
         std::make_unique<NiceMock<ClockMock>>();
+    NumericThresholdTables tables;
 
     void makeThreshold(Milliseconds dwellTime, numeric::Direction direction,
                        double thresholdValue,
@@ -34,11 +37,17 @@ class TestNumericThreshold : public Test
         actions.push_back(std::move(actionMockPtr));
 
         sut = std::make_shared<NumericThreshold>(
-            DbusEnvironment::getIoc(), triggerId,
+            timerWheel, triggerId,
             utils::convContainer<std::shared_ptr<interfaces::Sensor>>(
                 sensorMocks),
             std::move(actions), dwellTime, direction, thresholdValue, type,
-            std::move(clockMockPtr));
+            std::move(clockMockPtr), tables);
+    }
+
+    void sensorUpdated(size_t index, Milliseconds timestamp, double value)
+    {
+        auto& sensor = sensorMocks.at(index);
+        tables.get(sensor)->sensorUpdated(*sensor, timestamp, value);
     }
 
     void SetUp() override
@@ -59,14 +68,75 @@ TEST_F(TestNumericThreshold, initializeThresholdExpectAllSensorsAreRegistered)
     for (auto& sensor : sensorMocks)
     {
         EXPECT_CALL(*sensor,
-                    registerForUpdates(Truly([sut = sut.get()](const auto& x) {
-                        return x.lock().get() == sut;
+                    registerForUpdates(Truly([table = tables.get(sensor)](
+                                                 const auto& x) {
+                        return x.lock() == table;
                     })));
     }
 
     sut->initialize();
 }
 
+TEST_F(TestNumericThreshold, thresholdsOfOneSensorShareSingleRegistration)
+{
+    auto other = std::make_shared<NumericThreshold>(
+        timerWheel, triggerId,
+        utils::convContainer<std::shared_ptr<interfaces::Sensor>>(sensorMocks),
+        std::vector<std::unique_ptr<interfaces::TriggerAction>>{}, 0ms,
+        numeric::Direction::decreasing, 10.0, numeric::Type::lowerCritical,
+        std::make_unique<NiceMock<ClockMock>>(), tables);
+
+    for (auto& sensor : sensorMocks)
+    {
+        EXPECT_CALL(*sensor, registerForUpdates(_)).Times(1);
+    }
+
+    sut->initialize();
+    other->initialize();
+}
+
+TEST_F(TestNumericThreshold, unregistersWhenLastThresholdIsRemoved)
+{
+    sut->initialize();
+
+    for (auto& sensor : sensorMocks)
+    {
+        EXPECT_CALL(*sensor, unregisterFromUpdates(_));
+    }
+
+    sut = nullptr;
+}
+
+TEST_F(TestNumericThreshold, commitsOnlyCrossedThresholdsOfSensor)
+{
+    std::vector<std::unique_ptr<interfaces::TriggerAction>> actions;
+    auto otherActionPtr = std::make_unique<StrictMock<TriggerActionMock>>();
+    auto& otherAction = *otherActionPtr;
+    actions.push_back(std::move(otherActionPtr));
+
+    auto other = std::make_shared<NumericThreshold>(
+        timerWheel, triggerId,
+        utils::convContainer<std::shared_ptr<interfaces::Sensor>>(sensorMocks),
+        std::move(actions), 0ms, numeric::Direction::increasing, 50.0,
+        numeric::Type::upperWarning, std::make_unique<NiceMock<ClockMock>>(),
+        tables);
+
+    sut->initialize();
+    other->initialize();
+
+    EXPECT_CALL(otherAction, commit(triggerId, Eq(std::nullopt), "Sensor1", _,
+                                    TriggerValue(60.0)));
+    EXPECT_CALL(otherAction, commit(triggerId, Eq(std::nullopt), "Sensor1", _,
+                                    TriggerValue(95.0)))
+        .Times(0);
+    EXPECT_CALL(actionMock, commit(triggerId, Eq(std::nullopt), "Sensor1", _,
+                                   TriggerValue(95.0)));
+
+    sensorUpdated(0, 0ms, 40.0);
+    sensorUpdated(0, 1ms, 60.0);
+    sensorUpdated(0, 2ms, 95.0);
+}
+
 TEST_F(TestNumericThreshold, thresholdIsNotInitializeExpectNoActionCommit)
 {
     EXPECT_CALL(actionMock, commit(_, _, _, _, _)).Times(0);
@@ -216,7 +286,7 @@ class TestNumericThresholdCommon :
         size_t idx = 0;
         for (const double value : GetParam().initialValues)
         {
-            sut->sensorUpdated(*sensorMocks[idx], 0ms, value);
+            sensorUpdated(idx, 0ms, value);
             idx++;
         }
 
@@ -225,7 +295,7 @@ class TestNumericThresholdCommon :
             ASSERT_LT(index, GetParam().initialValues.size())
                 << "Initial value was not specified for sensor with index: "
                 << index;
-            sut->sensorUpdated(*sensorMocks[index], 42ms, value);
+            sensorUpdated(index, 42ms, value);
             sleep(sleepAfter);
         }
 
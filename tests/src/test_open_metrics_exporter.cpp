@@ -0,0 +1,161 @@
+#include "dbus_environment.hpp"
+#include "helpers.hpp"
+#include "messages/readings_removed_ind.hpp"
+#include "messages/readings_updated_ind.hpp"
+#include "open_metrics_exporter.hpp"
+#include "utils/circular_vector.hpp"
+#include "utils/messanger.hpp"
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include <limits>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+class TestOpenMetricsExporter : public Test
+{
+  public:
+    const std::filesystem::path socketPath =
+        std::filesystem::temp_directory_path() / "telemetry_ut_metrics.sock";
+    OpenMetricsExporter sut{DbusEnvironment::getIoc(), socketPath};
+    utils::Messanger messanger{DbusEnvironment::getIoc()};
+
+    static std::string body(std::string_view samples)
+    {
+        return "# TYPE telemetry_reading gauge\n"
+               "# HELP telemetry_reading Latest readings of telemetry "
+               "reports\n" +
+               std::string(samples) + "# EOF\n";
+    }
+
+    using Socket = boost::asio::local::stream_protocol::socket;
+
+    std::shared_ptr<Socket> connect()
+    {
+        auto socket = std::make_shared<Socket>(DbusEnvironment::getIoc());
+        socket->connect(socketPath.string());
+        return socket;
+    }
+
+    std::string scrape()
+    {
+        return send("GET /metrics HTTP/1.0\r\n\r\n");
+    }
+
+    /** Returns everything received until the exporter closes the socket */
+    std::string send(std::string_view request)
+    {
+        auto socket = connect();
+        auto response = std::make_shared<std::string>();
+        std::promise<std::string> promise;
+        auto future = promise.get_future();
+
+        boost::asio::write(*socket, boost::asio::buffer(request));
+        boost::asio::async_read(
+            *socket, boost::asio::dynamic_buffer(*response),
+            [socket, response, promise = std::move(promise)](
+                boost::system::error_code, size_t) mutable {
+                promise.set_value(*response);
+            });
+
+        return DbusEnvironment::waitForFuture(std::move(future));
+    }
+};
+
+TEST_F(TestOpenMetricsExporter, rendersOnlyHeaderWithoutReports)
+{
+    EXPECT_THAT(sut.render(), Eq(body("")));
+}
+
+TEST_F(TestOpenMetricsExporter, rendersReadingsOfUpdatedReports)
+{
+    messanger.send(messages::ReadingsUpdatedInd{
+        "Report1", Readings{0u, {{"metric\"1\"", 1.5, 1700000000123u}}}});
+    messanger.send(messages::ReadingsUpdatedInd{
+        "Report2",
+        Readings{0u,
+                 {{"metric2", std::numeric_limits<double>::quiet_NaN(), 5u}}}});
+
+    EXPECT_THAT(
+        sut.render(),
+        Eq(body("telemetry_reading{report=\"Report1\","
+                "metric=\"metric\\\"1\\\"\"} 1.5 1700000000.123\n"
+                "telemetry_reading{report=\"Report2\",metric=\"metric2\"} NaN"
+                " 0.005\n")));
+}
+
+TEST_F(TestOpenMetricsExporter, replacesPreviousReadingsOfReport)
+{
+    sut.update("Report1", Readings{0u, {{"metric1", 1.0, 1000u}}});
+    sut.update("Report1", Readings{0u, {{"metric1", 2.0, 2000u}}});
+
+    EXPECT_THAT(sut.render(),
+                Eq(body("telemetry_reading{report=\"Report1\","
+                        "metric=\"metric1\"} 2 2.000\n")));
+}
+
+TEST_F(TestOpenMetricsExporter, dropsReadingsOfRemovedReports)
+{
+    sut.update("Report1", Readings{0u, {{"metric1", 1.0, 1000u}}});
+
+    messanger.send(messages::ReadingsRemovedInd{"Report1"});
+
+    EXPECT_THAT(sut.render(), Eq(body("")));
+}
+
+TEST_F(TestOpenMetricsExporter, servesRenderedReadingsOnSocket)
+{
+    sut.update("Report1", Readings{0u, {{"metric1", 1.0, 1000u}}});
+
+    const auto response = scrape();
+
+    EXPECT_THAT(response, StartsWith("HTTP/1.0 200 OK\r\n"));
+    EXPECT_THAT(response, HasSubstr("Content-Length: " +
+                                    std::to_string(sut.render().size())));
+    EXPECT_THAT(response, EndsWith("\r\n\r\n" + sut.render()));
+}
+
+TEST_F(TestOpenMetricsExporter, rendersOnlyNewestReadingOfWrappedAppendReport)
+{
+    Readings readings;
+    CircularVector<ReadingData> buffer(std::get<1>(readings), 4);
+    for (uint64_t timestamp : {1000u, 2000u, 3000u})
+    {
+        buffer.emplace("metric1", static_cast<double>(timestamp), timestamp);
+        buffer.emplace("metric2", -static_cast<double>(timestamp), timestamp);
+    }
+
+    sut.update("Report1", readings);
+
+    EXPECT_THAT(sut.render(),
+                Eq(body("telemetry_reading{report=\"Report1\","
+                        "metric=\"metric1\"} 3000 3.000\n"
+                        "telemetry_reading{report=\"Report1\","
+                        "metric=\"metric2\"} -3000 3.000\n")));
+}
+
+TEST_F(TestOpenMetricsExporter, closesSessionWithIncompleteRequest)
+{
+    EXPECT_THAT(send("GET /metrics HTTP/1.0\r\n"), IsEmpty());
+}
+
+TEST_F(TestOpenMetricsExporter, closesConnectionsAboveSessionLimit)
+{
+    std::vector<std::shared_ptr<Socket>> idleClients;
+    for (size_t i = 0; i < OpenMetricsExporter::maxSessions; ++i)
+    {
+        idleClients.emplace_back(connect());
+    }
+    DbusEnvironment::sleepFor(Milliseconds(50));
+
+    EXPECT_THAT(scrape(), IsEmpty());
+
+    idleClients.clear();
+    DbusEnvironment::sleepFor(Milliseconds(50));
+
+    EXPECT_THAT(scrape(), StartsWith("HTTP/1.0 200 OK\r\n"));
+}
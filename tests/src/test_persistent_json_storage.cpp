@@ -49,6 +49,21 @@ TEST_F(TestPersistentJsonStorage, storesJsonData)
     ASSERT_THAT(sut.load(fileName), Eq(data));
 }
 
+TEST_F(TestPersistentJsonStorage, storesSerializedData)
+{
+    const std::string data = R"({"lastname":"mc calister","name":"kevin"})";
+
+    sut.storeSerialized(fileName, data);
+
+    EXPECT_THAT(sut.loadSerialized(fileName), Optional(data));
+    EXPECT_THAT(sut.load(fileName), Optional(nlohmann::json::parse(data)));
+}
+
+TEST_F(TestPersistentJsonStorage, loadSerializedReturnsNulloptForMissingFile)
+{
+    EXPECT_THAT(sut.loadSerialized(fileName), Eq(std::nullopt));
+}
+
 TEST_F(TestPersistentJsonStorage, emptyListWhenNoReportsCreated)
 {
     EXPECT_THAT(sut.list(), SizeIs(0u));
@@ -0,0 +1,75 @@
+#include "dbus_environment.hpp"
+#include "helpers.hpp"
+#include "utils/properties_changed.hpp"
+
+#include <systemd/sd-bus.h>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+class TestPropertiesChanged : public Test
+{
+  public:
+    using Properties =
+        std::vector<std::pair<std::string, std::variant<double, std::string>>>;
+
+    sdbusplus::message_t makeSignal(const std::string& interface,
+                                    const Properties& properties)
+    {
+        auto message = DbusEnvironment::getBus()->new_signal(
+            "/test/sensor", "org.freedesktop.DBus.Properties",
+            "PropertiesChanged");
+        message.append(interface, properties, std::vector<std::string>{});
+        sd_bus_message_seal(message.get(), ++cookie, 0);
+        sd_bus_message_rewind(message.get(), 1);
+        return message;
+    }
+
+    utils::ChangedProperty read(sdbusplus::message_t message)
+    {
+        return utils::readChangedProperty(message, "xyz.Iface", "Value");
+    }
+
+    uint64_t cookie = 0;
+};
+
+TEST_F(TestPropertiesChanged, readsRequestedProperty)
+{
+    auto result = read(makeSignal("xyz.Iface", {{"Value", 42.5}}));
+
+    EXPECT_THAT(result.found, Eq(true));
+    EXPECT_THAT(result.value, Optional(42.5));
+}
+
+TEST_F(TestPropertiesChanged, skipsOtherProperties)
+{
+    auto result = read(makeSignal("xyz.Iface", {{"Unit", std::string("C")},
+                                                {"MaxValue", 1.0},
+                                                {"Value", 7.0}}));
+
+    EXPECT_THAT(result.value, Optional(7.0));
+}
+
+TEST_F(TestPropertiesChanged, notFoundWhenPropertyIsMissing)
+{
+    auto result = read(makeSignal("xyz.Iface", {{"MaxValue", 1.0}}));
+
+    EXPECT_THAT(result.found, Eq(false));
+    EXPECT_THAT(result.value, Eq(std::nullopt));
+}
+
+TEST_F(TestPropertiesChanged, notFoundForOtherInterface)
+{
+    auto result = read(makeSignal("xyz.Other", {{"Value", 1.0}}));
+
+    EXPECT_THAT(result.found, Eq(false));
+}
+
+TEST_F(TestPropertiesChanged, foundWithoutValueWhenTypeDiffers)
+{
+    auto result = read(makeSignal("xyz.Iface", {{"Value", std::string("1")}}));
+
+    EXPECT_THAT(result.found, Eq(true));
+    EXPECT_THAT(result.value, Eq(std::nullopt));
+}
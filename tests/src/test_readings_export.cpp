@@ -0,0 +1,109 @@
+#include "helpers.hpp"
+#include "readings_export.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+class TestReadingsExport : public Test
+{
+  public:
+    ReadingsExport sut{4};
+    void* address = nullptr;
+
+    void SetUp() override
+    {
+        address = ::mmap(nullptr, sut.size(), PROT_READ, MAP_SHARED,
+                         sut.getFd(), 0);
+        ASSERT_THAT(address, Ne(MAP_FAILED));
+    }
+
+    void TearDown() override
+    {
+        ::munmap(address, sut.size());
+    }
+
+    const ReadingsExport::Header& header() const
+    {
+        return *static_cast<const ReadingsExport::Header*>(address);
+    }
+
+    std::optional<Readings> read() const
+    {
+        return ReadingsExport::read(std::span<const std::byte>(
+            static_cast<const std::byte*>(address), sut.size()));
+    }
+};
+
+TEST_F(TestReadingsExport, initiallyExportsEmptyReadings)
+{
+    EXPECT_THAT(read(), Optional(Readings{0u, {}}));
+}
+
+TEST_F(TestReadingsExport, exportsPublishedReadings)
+{
+    const Readings readings{10u, {{"metric1", 1.5, 2u}, {"metric2", 2.5, 3u}}};
+
+    sut.publish(readings);
+
+    EXPECT_THAT(read(), Optional(readings));
+}
+
+TEST_F(TestReadingsExport, exportsReadingsCountWhenRecordsAreTruncated)
+{
+    Readings readings{1u, {}};
+    for (uint64_t i = 0; i < 6; ++i)
+    {
+        std::get<1>(readings).emplace_back("metric", 1.0, i);
+    }
+
+    sut.publish(readings);
+
+    EXPECT_THAT(header().recordCount, Eq(4u));
+    EXPECT_THAT(header().readingsCount, Eq(6u));
+    EXPECT_THAT(read(),
+                Optional(Readings{1u,
+                                  {{"metric", 1.0, 0u},
+                                   {"metric", 1.0, 1u},
+                                   {"metric", 1.0, 2u},
+                                   {"metric", 1.0, 3u}}}));
+}
+
+TEST_F(TestReadingsExport, reusesPoolForChangingMetricIds)
+{
+    for (size_t i = 0; i < 20; ++i)
+    {
+        sut.publish(Readings{i, {{"metric" + std::to_string(i), 1.0, i}}});
+    }
+
+    EXPECT_THAT(read(), Optional(Readings{19u, {{"metric19", 1.0, 19u}}}));
+}
+
+TEST_F(TestReadingsExport, exportsEmptyIdWhenItDoesNotFitIntoPool)
+{
+    const std::string longId(sut.size(), 'x');
+
+    sut.publish(Readings{1u, {{longId, 1.0, 1u}, {"metric", 2.0, 1u}}});
+
+    EXPECT_THAT(read(),
+                Optional(Readings{1u, {{"", 1.0, 1u}, {"metric", 2.0, 1u}}}));
+}
+
+TEST_F(TestReadingsExport, descriptorIsReadOnlyAndSealed)
+{
+    EXPECT_THAT(::mmap(nullptr, sut.size(), PROT_READ | PROT_WRITE,
+                       MAP_SHARED, sut.getFd(), 0),
+                Eq(MAP_FAILED));
+    EXPECT_THAT(::fcntl(sut.getFd(), F_GET_SEALS),
+                Eq(F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL));
+}
+
+TEST_F(TestReadingsExport, rejectsForeignMapping)
+{
+    std::vector<std::byte> data(sut.size());
+
+    EXPECT_THAT(ReadingsExport::read(data), Eq(std::nullopt));
+}
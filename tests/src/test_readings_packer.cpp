@@ -0,0 +1,72 @@
+#include "helpers.hpp"
+#include "utils/readings_packer.hpp"
+
+#include <limits>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+class TestReadingsPacker : public Test
+{
+  public:
+    utils::ReadingsPacker sut;
+};
+
+TEST_F(TestReadingsPacker, packsEmptyReadings)
+{
+    sut.pack(Readings{10u, {}});
+
+    EXPECT_THAT(sut.get().size(), Eq(20u));
+    EXPECT_THAT(utils::ReadingsPacker::unpack(sut.get()),
+                Eq(Readings{10u, {}}));
+}
+
+TEST_F(TestReadingsPacker, unpacksPackedReadings)
+{
+    const Readings readings{
+        1000u,
+        {{"metric1", 1.5, 10u},
+         {"metric2", std::numeric_limits<double>::infinity(), 11u},
+         {"metric1", -2.5, 12u}}};
+
+    sut.pack(readings);
+
+    EXPECT_THAT(utils::ReadingsPacker::unpack(sut.get()), Eq(readings));
+}
+
+TEST_F(TestReadingsPacker, storesRepeatedMetricIdsOnce)
+{
+    sut.pack(Readings{0u, {{"metric", 1.0, 0u}}});
+    const auto singleSize = sut.get().size();
+
+    sut.pack(Readings{0u, {{"metric", 1.0, 0u}, {"metric", 2.0, 0u}}});
+
+    EXPECT_THAT(sut.get().size(), Eq(singleSize + 20u));
+}
+
+TEST_F(TestReadingsPacker, encodesHeaderInLittleEndian)
+{
+    sut.pack(Readings{0x0102u, {}});
+
+    EXPECT_THAT(std::vector<uint8_t>(sut.get().begin(), sut.get().begin() + 10),
+                ElementsAre(1, 0, 0, 0, 0, 0, 0, 0, 0x02, 0x01));
+}
+
+TEST_F(TestReadingsPacker, throwsOnTruncatedInput)
+{
+    sut.pack(Readings{0u, {{"metric", 1.0, 0u}}});
+    auto data = sut.get();
+    data.pop_back();
+
+    EXPECT_THROW(utils::ReadingsPacker::unpack(data), std::invalid_argument);
+}
+
+TEST_F(TestReadingsPacker, throwsOnUnsupportedVersion)
+{
+    sut.pack(Readings{0u, {}});
+    auto data = sut.get();
+    data[0] = 2;
+
+    EXPECT_THROW(utils::ReadingsPacker::unpack(data), std::invalid_argument);
+}
@@ -0,0 +1,141 @@
+#include "dbus_environment.hpp"
+#include "helpers.hpp"
+#include "readings_subscription.hpp"
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/bus/match.hpp>
+
+#include <optional>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace std::chrono_literals;
+using namespace std::string_literals;
+
+class TestReadingsSubscription : public Test
+{
+  public:
+    const sdbusplus::object_path path =
+        sdbusplus::object_path("/xyz/openbmc_project/Telemetry/Reports/"
+                               "Report1/Subscriptions/0");
+    MockFunction<void(ReadingsSubscription&)> removeMock;
+    size_t signals = 0;
+    sdbusplus::bus::match_t propertiesChangedMatch{
+        *DbusEnvironment::getBus(),
+        sdbusplus::bus::match::rules::propertiesChanged(
+            path.str, ReadingsSubscription::interface),
+        [this](sdbusplus::message_t&) { ++signals; }};
+
+    std::unique_ptr<ReadingsSubscription> makeSubscription(
+        std::vector<std::string> metricFilter, Milliseconds minInterval,
+        std::string client = DbusEnvironment::getBus()->get_unique_name())
+    {
+        return std::make_unique<ReadingsSubscription>(
+            DbusEnvironment::getBus(), DbusEnvironment::getObjServer(), path,
+            std::move(client), std::move(metricFilter), minInterval,
+            removeMock.AsStdFunction());
+    }
+
+    Readings getReadings() const
+    {
+        return DbusEnvironment::getProperty<Readings>(
+            path.str, ReadingsSubscription::interface, "Readings");
+    }
+
+    void TearDown() override
+    {
+        DbusEnvironment::synchronizeIoc();
+    }
+};
+
+TEST_F(TestReadingsSubscription, exposesOnlyFilteredReadings)
+{
+    auto sut = makeSubscription({"metric2"}, 0ms);
+
+    sut->update(Readings{10u, {{"metric1", 1.0, 1u}, {"metric2", 2.0, 2u}}});
+
+    EXPECT_THAT(getReadings(), Eq(Readings{10u, {{"metric2", 2.0, 2u}}}));
+}
+
+TEST_F(TestReadingsSubscription, emptyFilterMatchesAllMetrics)
+{
+    auto sut = makeSubscription({}, 0ms);
+    const Readings readings{10u, {{"metric1", 1.0, 1u}, {"metric2", 2.0, 2u}}};
+
+    sut->update(readings);
+
+    EXPECT_THAT(getReadings(), Eq(readings));
+}
+
+TEST_F(TestReadingsSubscription, coalescesUpdatesWithinMinInterval)
+{
+    auto sut = makeSubscription({}, 100ms);
+
+    sut->update(Readings{1u, {}});
+    sut->update(Readings{2u, {}});
+    sut->update(Readings{3u, {}});
+    DbusEnvironment::sleepFor(20ms);
+
+    EXPECT_THAT(signals, Eq(1u));
+
+    DbusEnvironment::sleepFor(150ms);
+
+    EXPECT_THAT(signals, Eq(2u));
+    EXPECT_THAT(getReadings(), Eq(Readings{3u, {}}));
+}
+
+TEST_F(TestReadingsSubscription, requestsRemovalOnDelete)
+{
+    auto sut = makeSubscription({}, 0ms);
+
+    EXPECT_CALL(removeMock, Call(Ref(*sut)));
+
+    EXPECT_THAT(DbusEnvironment::callMethod(path.str,
+                                            "xyz.openbmc_project.Object.Delete",
+                                            "Delete"),
+                Eq(boost::system::errc::success));
+}
+
+TEST_F(TestReadingsSubscription, requestsRemovalOnlyOnce)
+{
+    auto sut = makeSubscription({}, 0ms);
+
+    EXPECT_CALL(removeMock, Call(Ref(*sut)));
+
+    for (size_t i = 0; i < 2; ++i)
+    {
+        EXPECT_THAT(DbusEnvironment::callMethod(
+                        path.str, "xyz.openbmc_project.Object.Delete",
+                        "Delete"),
+                    Eq(boost::system::errc::success));
+    }
+}
+
+TEST_F(TestReadingsSubscription, requestsRemovalWhenClientLeavesTheBus)
+{
+    auto client = std::make_optional(sdbusplus::bus::new_bus());
+    auto sut = makeSubscription({}, 0ms, client->get_unique_name());
+    DbusEnvironment::synchronizeIoc();
+
+    EXPECT_CALL(removeMock, Call(Ref(*sut)))
+        .WillOnce(InvokeWithoutArgs(DbusEnvironment::setPromise("remove")));
+
+    client = std::nullopt;
+
+    EXPECT_THAT(DbusEnvironment::waitForFuture("remove"), Eq(true));
+}
+
+TEST_F(TestReadingsSubscription, requestsRemovalWhenClientIsAlreadyGone)
+{
+    auto client = std::make_optional(sdbusplus::bus::new_bus());
+    const std::string clientName = client->get_unique_name();
+    client = std::nullopt;
+
+    EXPECT_CALL(removeMock, Call(_))
+        .WillOnce(InvokeWithoutArgs(DbusEnvironment::setPromise("remove")));
+
+    auto sut = makeSubscription({}, 0ms, clientName);
+
+    EXPECT_THAT(DbusEnvironment::waitForFuture("remove"), Eq(true));
+}
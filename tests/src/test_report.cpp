@@ -20,10 +20,15 @@
 #include "utils/transform.hpp"
 #include "utils/tstring.hpp"
 
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/exception.hpp>
+#include <sdbusplus/server/manager.hpp>
 #include <xyz/openbmc_project/Object/Delete/common.hpp>
+#include <systemd/sd-bus.h>
 #include <xyz/openbmc_project/Telemetry/Report/common.hpp>
 
+#include <optional>
 #include <ranges>
 
 using namespace testing;
@@ -97,7 +102,7 @@ class TestReport : public Test
 
         for (size_t i = 0; i < metricParameters.size(); ++i)
         {
-            ON_CALL(*metricMocks[i], getUpdatedReadings())
+            ON_CALL(*metricMocks[i], getUpdatedReadings(_))
                 .WillByDefault(ReturnRefOfCopy(std::vector({readings[i]})));
             ON_CALL(*metricMocks[i], dumpConfiguration())
                 .WillByDefault(Return(metricParameters[i]));
@@ -142,8 +147,9 @@ class TestReport : public Test
         initMetricMocks(params.metricParameters());
 
         return std::make_unique<Report>(
-            DbusEnvironment::getIoc(), DbusEnvironment::getObjServer(),
-            params.reportId(), params.reportName(), params.reportingType(),
+            DbusEnvironment::getIoc(), DbusEnvironment::getBus(),
+            DbusEnvironment::getObjServer(), params.reportId(),
+            params.reportName(), params.reportingType(),
             params.reportActions(), params.interval(), params.appendLimit(),
             params.reportUpdates(), *reportManagerMock, storageMock,
             utils::convContainer<std::shared_ptr<interfaces::Metric>>(
@@ -209,6 +215,86 @@ class TestReport : public Test
         return DbusEnvironment::waitForFuture(methodPromise.get_future());
     }
 
+    sdbusplus::message::object_path subscribe(
+        const std::string& path, std::vector<std::string> metricFilter)
+    {
+        std::promise<sdbusplus::message::object_path> promise;
+        auto future = promise.get_future();
+        DbusEnvironment::getBus()->async_method_call(
+            [&promise](boost::system::error_code ec,
+                       sdbusplus::message::object_path subscription) {
+                promise.set_value(ec ? sdbusplus::message::object_path{}
+                                     : subscription);
+            },
+            DbusEnvironment::serviceName(), path, ReadingsExport::interface,
+            "Subscribe", metricFilter, uint64_t{0});
+        return DbusEnvironment::waitForFuture(std::move(future));
+    }
+
+    /** Subscribes from a separate connection, its unique name is the
+     * client of the subscription */
+    std::string subscribeAs(sdbusplus::bus_t& client, const std::string& path)
+    {
+        auto method = client.new_method_call(
+            DbusEnvironment::serviceName(), path.c_str(),
+            ReadingsExport::interface, "Subscribe");
+        method.append(std::vector<std::string>{}, uint64_t{0});
+
+        std::optional<std::string> subscription;
+        EXPECT_THAT(
+            sd_bus_call_async(
+                client.get(), nullptr, method.get(),
+                [](sd_bus_message* reply, void* userdata, sd_bus_error*) {
+                    const char* replyPath = "";
+                    sd_bus_message_read(reply, "o", &replyPath);
+                    *static_cast<std::optional<std::string>*>(userdata) =
+                        replyPath;
+                    return 0;
+                },
+                &subscription, 0),
+            Ge(0));
+        for (auto elapsed = 0ms; !subscription && elapsed < 1s;
+             elapsed += 10ms)
+        {
+            DbusEnvironment::sleepFor(10ms);
+            while (sd_bus_process(client.get(), nullptr) > 0)
+            {}
+        }
+        return subscription.value_or("");
+    }
+
+    std::pair<boost::system::error_code, std::vector<ReadingData>>
+        getReadings(const std::string& path, uint64_t start, uint64_t end,
+                    uint64_t maxPoints)
+    {
+        std::promise<
+            std::pair<boost::system::error_code, std::vector<ReadingData>>>
+            promise;
+        auto future = promise.get_future();
+        DbusEnvironment::getBus()->async_method_call(
+            [&promise](boost::system::error_code ec,
+                       std::vector<ReadingData> readings) {
+                promise.set_value({ec, std::move(readings)});
+            },
+            DbusEnvironment::serviceName(), path, ReadingsExport::interface,
+            "GetReadings", start, end, maxPoints);
+        return DbusEnvironment::waitForFuture(std::move(future));
+    }
+
+    static bool subscriptionExists(const std::string& path)
+    {
+        try
+        {
+            DbusEnvironment::getProperty<Readings>(
+                path, ReadingsSubscription::interface, "Readings");
+            return true;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+
     boost::system::error_code update(const std::string& path)
     {
         return call(path, TelemetryReport::interface,
@@ -423,6 +509,97 @@ TEST_F(TestReport, setReportActionsWithInvalidActions)
         })));
 }
 
+TEST_F(TestReport, objectManagerAnnouncesAddedAndRemovedReports)
+{
+    sdbusplus::server::manager_t objManager(*DbusEnvironment::getBus(),
+                                           utils::constants::telemetryPath);
+    std::vector<std::string> announced;
+    auto makeMatch = [&announced](const std::string& member) {
+        return std::make_unique<sdbusplus::bus::match_t>(
+            *DbusEnvironment::getBus(),
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='" + member + "',path='" +
+                utils::constants::telemetryPath + "'",
+            [&announced, member](sdbusplus::message_t& message) {
+                sdbusplus::message::object_path path;
+                message.read(path);
+                announced.emplace_back(member + " " + path.str);
+                DbusEnvironment::setPromise(member)();
+            });
+    };
+    auto addedMatch = makeMatch("InterfacesAdded");
+    auto removedMatch = makeMatch("InterfacesRemoved");
+
+    auto report = makeReport(ReportParams().reportId("TestId_1"));
+    const std::string path = report->getPath();
+    ASSERT_TRUE(DbusEnvironment::waitForFuture("InterfacesAdded"));
+
+    report = nullptr;
+    ASSERT_TRUE(DbusEnvironment::waitForFuture("InterfacesRemoved"));
+
+    EXPECT_THAT(announced, Contains("InterfacesAdded " + path));
+    EXPECT_THAT(announced, Contains("InterfacesRemoved " + path));
+}
+
+TEST_F(TestReport, readingsExportHandsOutDescriptor)
+{
+    EXPECT_THAT(DbusEnvironment::callMethod(
+                    sut->getPath(), ReadingsExport::interface, "GetReadingsFd"),
+                Eq(boost::system::errc::success));
+}
+
+TEST_F(TestReport, readingsPackedCarriesSameReadings)
+{
+    const auto packed = DbusEnvironment::getProperty<std::vector<uint8_t>>(
+        sut->getPath(), ReadingsExport::interface, "ReadingsPacked");
+
+    const auto readings = getProperty<Readings>(
+        sut->getPath(), TelemetryReport::property_names::readings);
+
+    EXPECT_THAT(utils::ReadingsPacker::unpack(packed), Eq(readings));
+}
+
+TEST_F(TestReport, getReadingsDownsamplesWrappedBufferInTimeOrder)
+{
+    sut = makeReport(defaultParams()
+                         .reportingType(ReportingType::periodic)
+                         .interval(std::chrono::hours(1000))
+                         .reportUpdates(ReportUpdates::appendWrapsWhenFull)
+                         .appendLimit(6));
+
+    std::vector<MetricValue> values;
+    uint64_t timestamp = 0;
+    ON_CALL(*metricMocks[0], getUpdatedReadings(_))
+        .WillByDefault([&values, &timestamp](const CollectionTimestamp&)
+                           -> const std::vector<MetricValue>& {
+            ++timestamp;
+            values = {MetricValue{"a", static_cast<double>(timestamp),
+                                  timestamp}};
+            return values;
+        });
+    ON_CALL(*metricMocks[1], getUpdatedReadings(_))
+        .WillByDefault(ReturnRefOfCopy(std::vector<MetricValue>()));
+
+    for (int i = 0; i < 8; ++i)
+    {
+        messanger.send(messages::UpdateReportInd{{sut->getId()}});
+    }
+
+    EXPECT_THAT(getReadings(sut->getPath(), 0u, 1000u, 3u),
+                Pair(Eq(boost::system::errc::success),
+                     ElementsAre(std::make_tuple("a"s, 3.5, 4u),
+                                 std::make_tuple("a"s, 5.5, 6u),
+                                 std::make_tuple("a"s, 7.5, 8u))));
+}
+
+TEST_F(TestReport, getRollupFailsWhenRollupsAreDisabled)
+{
+    EXPECT_THAT(DbusEnvironment::callMethod(
+                    sut->getPath(), ReadingsExport::interface, "GetRollup",
+                    uint64_t{60000}, uint64_t{0}, uint64_t{1000}),
+                Eq(boost::system::errc::invalid_argument));
+}
+
 TEST_F(TestReport, createReportWithEmptyActions)
 {
     std::vector<std::string> expectedActions = {
@@ -886,6 +1063,23 @@ TEST_F(TestReportOnRequestType, updatesReadingTimestamp)
     EXPECT_THAT(Milliseconds{timestamp}, Eq(systemTimestamp + 10ms));
 }
 
+TEST_F(TestReportOnRequestType, passesOneCollectionTimestampToAllMetrics)
+{
+    clockFake.advance(10ms);
+
+    for (auto& metric : metricMocks)
+    {
+        EXPECT_CALL(*metric,
+                    getUpdatedReadings(AllOf(
+                        Field(&CollectionTimestamp::steady,
+                              Eq(clockFake.steadyTimestamp())),
+                        Field(&CollectionTimestamp::system,
+                              Eq(systemTimestamp + 10ms)))));
+    }
+
+    ASSERT_THAT(update(sut->getPath()), Eq(boost::system::errc::success));
+}
+
 TEST_F(TestReportOnRequestType, updatesReadingWhenUpdateIsCalled)
 {
     ASSERT_THAT(update(sut->getPath()), Eq(boost::system::errc::success));
@@ -897,6 +1091,86 @@ TEST_F(TestReportOnRequestType, updatesReadingWhenUpdateIsCalled)
                                       std::make_tuple("bb"s, 42.0, 74u)));
 }
 
+TEST_F(TestReportOnRequestType, subscriptionExposesFilteredReadings)
+{
+    const auto path = subscribe(sut->getPath(), {"bb"});
+    ASSERT_THAT(path.str, StartsWith(sut->getPath() + "/Subscriptions/"));
+
+    ASSERT_THAT(update(sut->getPath()), Eq(boost::system::errc::success));
+
+    const auto [timestamp, readings] = DbusEnvironment::getProperty<Readings>(
+        path.str, ReadingsSubscription::interface, "Readings");
+
+    EXPECT_THAT(readings, ElementsAre(std::make_tuple("bb"s, 42.0, 74u)));
+}
+
+TEST_F(TestReportOnRequestType, subscriptionIsRemovedOnDelete)
+{
+    const auto path = subscribe(sut->getPath(), {});
+    ASSERT_THAT(path.str, StartsWith(sut->getPath() + "/Subscriptions/"));
+
+    ASSERT_THAT(call(path.str, ObjectDelete::interface,
+                     ObjectDelete::method_names::delete_),
+                Eq(boost::system::errc::success));
+    DbusEnvironment::synchronizeIoc();
+
+    EXPECT_FALSE(subscriptionExists(path.str));
+}
+
+TEST_F(TestReportOnRequestType, subscriptionIsRemovedWhenClientLeavesTheBus)
+{
+    auto client = std::make_optional(sdbusplus::bus::new_bus());
+    const std::string path = subscribeAs(*client, sut->getPath());
+    ASSERT_THAT(path, StartsWith(sut->getPath() + "/Subscriptions/"));
+    ASSERT_TRUE(subscriptionExists(path));
+
+    client = std::nullopt;
+
+    for (auto elapsed = 0ms; subscriptionExists(path) && elapsed < 1s;
+         elapsed += 10ms)
+    {
+        DbusEnvironment::sleepFor(10ms);
+    }
+    EXPECT_FALSE(subscriptionExists(path));
+}
+
+TEST_F(TestReportOnRequestType, subscriptionLimitIsAppliedPerClient)
+{
+    for (size_t i = 0; i < Report::maxSubscriptions; ++i)
+    {
+        ASSERT_THAT(subscribe(sut->getPath(), {}).str,
+                    StartsWith(sut->getPath() + "/Subscriptions/"));
+    }
+    EXPECT_THAT(subscribe(sut->getPath(), {}).str, IsEmpty());
+
+    auto client = sdbusplus::bus::new_bus();
+    EXPECT_THAT(subscribeAs(client, sut->getPath()),
+                StartsWith(sut->getPath() + "/Subscriptions/"));
+}
+
+TEST_F(TestReportOnRequestType, getReadingsReturnsReadingsWithinRange)
+{
+    ASSERT_THAT(update(sut->getPath()), Eq(boost::system::errc::success));
+
+    EXPECT_THAT(getReadings(sut->getPath(), 100u, 200u, 10u),
+                Pair(Eq(boost::system::errc::success),
+                     ElementsAre(std::make_tuple("b"s, 17.1, 114u))));
+}
+
+TEST_F(TestReportOnRequestType, getReadingsReturnsAtMostMaxPoints)
+{
+    ASSERT_THAT(update(sut->getPath()), Eq(boost::system::errc::success));
+
+    EXPECT_THAT(getReadings(sut->getPath(), 0u, 1000u, 1u),
+                Pair(Eq(boost::system::errc::success), SizeIs(1u)));
+}
+
+TEST_F(TestReportOnRequestType, getReadingsRejectsZeroMaxPoints)
+{
+    EXPECT_THAT(getReadings(sut->getPath(), 0u, 1000u, 0u).first,
+                Eq(boost::system::errc::invalid_argument));
+}
+
 class TestReportNonOnRequestType :
     public TestReport,
     public WithParamInterface<ReportParams>
@@ -1001,10 +1275,19 @@ struct ReportUpdatesReportParams
 
 class TestReportWithReportUpdatesAndLimit :
     public TestReport,
-    public WithParamInterface<ReportUpdatesReportParams>
+    public WithParamInterface<std::tuple<ReportUpdatesReportParams, bool>>
 {
   public:
-    void SetUp() override {}
+    void SetUp() override
+    {
+        ON_CALL(*reportFactoryMock, compressReadings())
+            .WillByDefault(Return(std::get<1>(GetParam())));
+    }
+
+    static const ReportUpdatesReportParams& param()
+    {
+        return std::get<0>(GetParam());
+    }
 
     void changeReport(ReportingType rt, Milliseconds interval)
     {
@@ -1030,133 +1313,135 @@ class TestReportWithReportUpdatesAndLimit :
 
 INSTANTIATE_TEST_SUITE_P(
     _, TestReportWithReportUpdatesAndLimit,
-    Values(
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::appendWrapsWhenFull)
-                .appendLimit(5),
-            std::vector<ReadingData>{{std::make_tuple("bb"s, 42.0, 74u),
-                                      std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u),
-                                      std::make_tuple("bb"s, 42.0, 74u),
-                                      std::make_tuple("b"s, 17.1, 114u)}},
-            true},
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::appendWrapsWhenFull)
-                .appendLimit(4),
-            std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u),
-                                      std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u)}},
-            true},
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::appendWrapsWhenFull)
-                .appendLimit(0),
-            std::vector<ReadingData>{}, true},
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::appendStopsWhenFull)
-                .appendLimit(10),
-            std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u),
-                                      std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u),
-                                      std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u),
-                                      std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u)}},
-            true},
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::appendStopsWhenFull)
-                .appendLimit(5),
-            std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u),
-                                      std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u),
-                                      std::make_tuple("b"s, 17.1, 114u)}},
-            false},
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::appendStopsWhenFull)
-                .appendLimit(4),
-            std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u),
-                                      std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u)}},
-            false},
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::appendStopsWhenFull)
-                .appendLimit(0),
-            std::vector<ReadingData>{}, false},
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::overwrite)
-                .appendLimit(500),
-            std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u)}},
-            true},
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::overwrite)
-                .appendLimit(1),
-            std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u)}},
-            true},
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::overwrite)
-                .appendLimit(0),
-            std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u)}},
-            true},
-        ReportUpdatesReportParams{
-            defaultParams()
-                .reportUpdates(ReportUpdates::appendStopsWhenFull)
-                .appendLimit(2u),
-            std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
-                                      std::make_tuple("bb"s, 42.0, 74u)}},
-            false}));
+    Combine(
+        Values(
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::appendWrapsWhenFull)
+                    .appendLimit(5),
+                std::vector<ReadingData>{{std::make_tuple("bb"s, 42.0, 74u),
+                                          std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u),
+                                          std::make_tuple("bb"s, 42.0, 74u),
+                                          std::make_tuple("b"s, 17.1, 114u)}},
+                true},
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::appendWrapsWhenFull)
+                    .appendLimit(4),
+                std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u),
+                                          std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u)}},
+                true},
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::appendWrapsWhenFull)
+                    .appendLimit(0),
+                std::vector<ReadingData>{}, true},
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::appendStopsWhenFull)
+                    .appendLimit(10),
+                std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u),
+                                          std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u),
+                                          std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u),
+                                          std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u)}},
+                true},
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::appendStopsWhenFull)
+                    .appendLimit(5),
+                std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u),
+                                          std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u),
+                                          std::make_tuple("b"s, 17.1, 114u)}},
+                false},
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::appendStopsWhenFull)
+                    .appendLimit(4),
+                std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u),
+                                          std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u)}},
+                false},
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::appendStopsWhenFull)
+                    .appendLimit(0),
+                std::vector<ReadingData>{}, false},
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::overwrite)
+                    .appendLimit(500),
+                std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u)}},
+                true},
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::overwrite)
+                    .appendLimit(1),
+                std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u)}},
+                true},
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::overwrite)
+                    .appendLimit(0),
+                std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u)}},
+                true},
+            ReportUpdatesReportParams{
+                defaultParams()
+                    .reportUpdates(ReportUpdates::appendStopsWhenFull)
+                    .appendLimit(2u),
+                std::vector<ReadingData>{{std::make_tuple("b"s, 17.1, 114u),
+                                          std::make_tuple("bb"s, 42.0, 74u)}},
+                false}),
+        Bool()));
 
 TEST_P(TestReportWithReportUpdatesAndLimit,
        readingsAreUpdatedAfterIntervalExpires)
 {
-    sut = makeReport(ReportParams(GetParam().reportParams)
+    sut = makeReport(ReportParams(param().reportParams)
                          .reportingType(ReportingType::periodic)
                          .interval(std::chrono::hours(1000)));
 
     updateReportFourTimes();
 
-    EXPECT_THAT(readings(), ElementsAreArray(GetParam().expectedReadings));
+    EXPECT_THAT(readings(), ElementsAreArray(param().expectedReadings));
     EXPECT_THAT(getProperty<bool>(sut->getPath(),
                                   TelemetryReport::property_names::enabled),
-                Eq(GetParam().expectedEnabled));
+                Eq(param().expectedEnabled));
 }
 
 TEST_P(TestReportWithReportUpdatesAndLimit,
        appendLimitIsRespectedAfterChangingToPeriodic)
 {
-    sut = makeReport(ReportParams(GetParam().reportParams)
-                         .appendLimit(GetParam().expectedReadings.size())
+    sut = makeReport(ReportParams(param().reportParams)
+                         .appendLimit(param().expectedReadings.size())
                          .reportingType(ReportingType::onRequest)
                          .interval(std::chrono::hours(0)));
 
     changeReport(ReportingType::periodic, std::chrono::hours(1000));
     updateReportFourTimes();
 
-    EXPECT_THAT(readings(), ElementsAreArray(GetParam().expectedReadings));
+    EXPECT_THAT(readings(), ElementsAreArray(param().expectedReadings));
     EXPECT_THAT(getProperty<bool>(sut->getPath(),
                                   TelemetryReport::property_names::enabled),
-                Eq(GetParam().expectedEnabled));
+                Eq(param().expectedEnabled));
 }
 
 TEST_P(TestReportWithReportUpdatesAndLimit,
        appendLimitIsIgnoredAfterChangingToOnRequest)
 {
-    sut = makeReport(ReportParams(GetParam().reportParams)
+    sut = makeReport(ReportParams(param().reportParams)
                          .reportingType(ReportingType::periodic)
                          .interval(std::chrono::hours(1000)));
 
@@ -1169,6 +1454,106 @@ TEST_P(TestReportWithReportUpdatesAndLimit,
                 Eq(true));
 }
 
+class TestReportWithCompressedReadings : public TestReport
+{
+  public:
+    void SetUp() override
+    {
+        ON_CALL(*reportFactoryMock, compressReadings())
+            .WillByDefault(Return(true));
+    }
+
+    static ReportParams appendParams(ReportUpdates reportUpdates,
+                                     uint64_t appendLimit)
+    {
+        return defaultParams()
+            .reportingType(ReportingType::periodic)
+            .interval(std::chrono::hours(1000))
+            .reportUpdates(reportUpdates)
+            .appendLimit(appendLimit);
+    }
+
+    void updateReport()
+    {
+        messanger.send(messages::UpdateReportInd{{sut->getId()}});
+    }
+
+    Readings readings()
+    {
+        return getProperty<Readings>(sut->getPath(),
+                                     TelemetryReport::property_names::readings);
+    }
+};
+
+TEST_F(TestReportWithCompressedReadings, keepsReadingsWhenSwitchingBuffers)
+{
+    sut = makeReport(appendParams(ReportUpdates::appendWrapsWhenFull, 2u));
+    updateReport();
+    const auto expected = std::get<1>(readings());
+    ASSERT_THAT(expected, ElementsAre(std::make_tuple("b"s, 17.1, 114u),
+                                      std::make_tuple("bb"s, 42.0, 74u)));
+
+    ASSERT_THAT(setProperty(sut->getPath(),
+                            TelemetryReport::property_names::report_updates,
+                            utils::enumToString(ReportUpdates::overwrite)),
+                Eq(boost::system::errc::success));
+    EXPECT_THAT(std::get<1>(readings()), Eq(expected));
+
+    ASSERT_THAT(
+        setProperty(sut->getPath(),
+                    TelemetryReport::property_names::report_updates,
+                    utils::enumToString(ReportUpdates::appendWrapsWhenFull)),
+        Eq(boost::system::errc::success));
+    EXPECT_THAT(std::get<1>(readings()), Eq(expected));
+}
+
+TEST_F(TestReportWithCompressedReadings,
+       restoresPersistedReadingsAndStopsWhenFull)
+{
+    const Readings restored{10u,
+                            {std::make_tuple("a"s, 1.0, 10u),
+                             std::make_tuple("b"s, 2.0, 20u)}};
+    sut = makeReport(appendParams(ReportUpdates::appendStopsWhenFull, 4u)
+                         .readings(restored));
+
+    EXPECT_THAT(readings(), Eq(restored));
+
+    updateReport();
+    updateReport();
+
+    const auto current = readings();
+    EXPECT_THAT(std::get<1>(current),
+                ElementsAre(std::make_tuple("a"s, 1.0, 10u),
+                            std::make_tuple("b"s, 2.0, 20u),
+                            std::make_tuple("b"s, 17.1, 114u),
+                            std::make_tuple("bb"s, 42.0, 74u)));
+    EXPECT_THAT(getProperty<bool>(sut->getPath(),
+                                  TelemetryReport::property_names::enabled),
+                Eq(false));
+    EXPECT_THAT(storedConfiguration.at("MetricValues").get<LabeledReadings>(),
+                Eq(utils::toLabeledReadings(current)));
+}
+
+TEST_F(TestReportWithCompressedReadings, exportsDecodedReadings)
+{
+    sut = makeReport(appendParams(ReportUpdates::appendWrapsWhenFull, 4u));
+    updateReport();
+    updateReport();
+
+    const auto current = readings();
+    ASSERT_THAT(std::get<1>(current), SizeIs(4u));
+
+    const auto packed = DbusEnvironment::getProperty<std::vector<uint8_t>>(
+        sut->getPath(), ReadingsExport::interface, "ReadingsPacked");
+    EXPECT_THAT(utils::ReadingsPacker::unpack(packed), Eq(current));
+    EXPECT_THAT(getReadings(sut->getPath(), 0u, 1000u, 10u),
+                Pair(Eq(boost::system::errc::success),
+                     UnorderedElementsAreArray(std::get<1>(current))));
+    EXPECT_THAT(DbusEnvironment::callMethod(
+                    sut->getPath(), ReadingsExport::interface, "GetReadingsFd"),
+                Eq(boost::system::errc::success));
+}
+
 class TestReportInitialization : public TestReport
 {
   public:
@@ -53,6 +53,7 @@ class TestReportManager : public Test
     {
         EXPECT_CALL(reportFactoryMock, convertMetricParams(_, _))
             .Times(AnyNumber());
+        EXPECT_CALL(reportFactoryMock, removeStaleHistory(IsEmpty()));
 
         sut = std::make_unique<ReportManager>(
             std::move(reportFactoryMockPtr), std::move(storageMockPtr),
@@ -552,6 +553,8 @@ class TestReportManagerStorage : public TestReportManager
     void SetUp() override
     {
         EXPECT_CALL(reportFactoryMock, convertMetricParams(_, _)).Times(0);
+        EXPECT_CALL(reportFactoryMock, removeStaleHistory(_))
+            .Times(AnyNumber());
 
         ON_CALL(storageMock, list())
             .WillByDefault(Return(std::vector<FilePath>{FilePath("report1")}));
@@ -586,6 +589,25 @@ TEST_F(TestReportManagerStorage, reportManagerCtorAddReportFromStorage)
     makeReportManager();
 }
 
+TEST_F(TestReportManagerStorage, reportManagerCtorRemovesStaleHistory)
+{
+    reportFactoryMock.expectMake(reportParams, _, Ref(storageMock));
+    EXPECT_CALL(reportFactoryMock,
+                removeStaleHistory(ElementsAre(reportParams.reportId())));
+
+    makeReportManager();
+}
+
+TEST_F(TestReportManagerStorage,
+       reportManagerCtorRemovesHistoryOfReportsThatFailedToLoad)
+{
+    data["Version"] = Report::reportVersion - 1;
+
+    EXPECT_CALL(reportFactoryMock, removeStaleHistory(IsEmpty()));
+
+    makeReportManager();
+}
+
 TEST_F(TestReportManagerStorage,
        reportManagerCtorRemoveFileIfVersionDoesNotMatch)
 {
@@ -0,0 +1,184 @@
+#include "dbus_environment.hpp"
+#include "helpers.hpp"
+#include "mocks/sensor_listener_mock.hpp"
+#include "sampling_scheduler.hpp"
+#include "sensor.hpp"
+#include "sensor_cache.hpp"
+#include "stubs/dbus_sensor_object.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+class TestSamplingPolicies : public Test
+{
+  public:
+    void TearDown() override
+    {
+        std::filesystem::remove(file);
+    }
+
+    void writeFile(const std::string& content)
+    {
+        std::ofstream(file) << content;
+    }
+
+    const std::filesystem::path file =
+        std::filesystem::temp_directory_path() /
+        "telemetry-tests-sampling-policies.json";
+};
+
+TEST_F(TestSamplingPolicies, loadsPoliciesFromFile)
+{
+    writeFile(R"([
+        {"Path": "/sensors/a", "Mode": "Poll", "Interval": 1000},
+        {"Path": "/sensors/", "Mode": "SignalRateLimited", "Interval": 50},
+        {"Path": "/sensors/b", "Mode": "Signal"}
+    ])");
+
+    EXPECT_THAT(
+        SamplingScheduler::loadPolicies(file),
+        ElementsAre(
+            Pair("/sensors/a", SamplingPolicy{SamplingMode::poll, 1000ms}),
+            Pair("/sensors/", SamplingPolicy{SamplingMode::signalRateLimited,
+                                             50ms}),
+            Pair("/sensors/b", SamplingPolicy{SamplingMode::signal, 0ms})));
+}
+
+TEST_F(TestSamplingPolicies, ignoresPoliciesWithoutInterval)
+{
+    writeFile(R"([{"Path": "/sensors/a", "Mode": "Poll"}])");
+
+    EXPECT_THAT(SamplingScheduler::loadPolicies(file), IsEmpty());
+}
+
+TEST_F(TestSamplingPolicies, returnsNoPoliciesForInvalidFile)
+{
+    writeFile(R"([{"Path": "/sensors/a", "Mode": "Sometimes"}])");
+
+    EXPECT_THAT(SamplingScheduler::loadPolicies(file), IsEmpty());
+}
+
+TEST_F(TestSamplingPolicies, returnsNoPoliciesForMissingFile)
+{
+    EXPECT_THAT(SamplingScheduler::loadPolicies(file), IsEmpty());
+}
+
+TEST_F(TestSamplingPolicies, matchesExactPathBeforeLongestPrefix)
+{
+    SamplingScheduler sut(
+        DbusEnvironment::getBus(),
+        {{"/sensors/", {SamplingMode::poll, 1000ms}},
+         {"/sensors/power/", {SamplingMode::poll, 100ms}},
+         {"/sensors/power/total", {SamplingMode::signalRateLimited, 10ms}}});
+
+    EXPECT_THAT(sut.policyFor("/sensors/power/total"),
+                Eq(SamplingPolicy{SamplingMode::signalRateLimited, 10ms}));
+    EXPECT_THAT(sut.policyFor("/sensors/power/psu0"),
+                Eq(SamplingPolicy{SamplingMode::poll, 100ms}));
+    EXPECT_THAT(sut.policyFor("/sensors/temperature/cpu0"),
+                Eq(SamplingPolicy{SamplingMode::poll, 1000ms}));
+    EXPECT_THAT(sut.policyFor("/other"), Eq(SamplingPolicy{}));
+}
+
+TEST(TestSamplingSchedulerErrors, recognizesMissingObjectManager)
+{
+    EXPECT_TRUE(SamplingScheduler::isObjectManagerMissing(
+        "org.freedesktop.DBus.Error.UnknownMethod"));
+    EXPECT_TRUE(SamplingScheduler::isObjectManagerMissing(
+        "org.freedesktop.DBus.Error.UnknownInterface"));
+    EXPECT_TRUE(SamplingScheduler::isObjectManagerMissing(
+        "org.freedesktop.DBus.Error.UnknownObject"));
+    EXPECT_FALSE(SamplingScheduler::isObjectManagerMissing(
+        "org.freedesktop.DBus.Error.NoReply"));
+    EXPECT_FALSE(SamplingScheduler::isObjectManagerMissing(
+        "org.freedesktop.DBus.Error.Timeout"));
+    EXPECT_FALSE(SamplingScheduler::isObjectManagerMissing(
+        "org.freedesktop.DBus.Error.ServiceUnknown"));
+}
+
+class TestSamplingScheduler : public Test
+{
+  public:
+    void SetUp() override
+    {
+        sensorObject->setValue(42.7);
+    }
+
+    void TearDown() override
+    {
+        sut = nullptr;
+        DbusEnvironment::synchronizeIoc();
+    }
+
+    void makeSensor(SamplingPolicy policy)
+    {
+        scheduler = std::make_unique<SamplingScheduler>(
+            DbusEnvironment::getBus(),
+            SamplingScheduler::Policies{{sensorObject->path(), policy}});
+        sut = sensorCache.makeSensor<Sensor>(
+            DbusEnvironment::serviceName(), sensorObject->path(), "metadata",
+            DbusEnvironment::getIoc(), DbusEnvironment::getBus(),
+            scheduler.get());
+    }
+
+    void registerForUpdates()
+    {
+        EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, 42.7))
+            .WillOnce(
+                InvokeWithoutArgs(DbusEnvironment::setPromise("async_read")));
+
+        sut->registerForUpdates(listenerMock);
+
+        ASSERT_TRUE(DbusEnvironment::waitForFuture("async_read"));
+    }
+
+    std::unique_ptr<stubs::DbusSensorObject> sensorObject =
+        std::make_unique<stubs::DbusSensorObject>(
+            DbusEnvironment::getIoc(), DbusEnvironment::getBus(),
+            DbusEnvironment::getObjServer());
+
+    SensorCache sensorCache;
+    std::unique_ptr<SamplingScheduler> scheduler;
+    std::shared_ptr<Sensor> sut;
+    std::shared_ptr<SensorListenerMock> listenerMock =
+        std::make_shared<StrictMock<SensorListenerMock>>();
+};
+
+TEST_F(TestSamplingScheduler, polledSensorPicksUpSilentChanges)
+{
+    makeSensor({SamplingMode::poll, 10ms});
+    registerForUpdates();
+
+    EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, 11.0))
+        .WillOnce(InvokeWithoutArgs(DbusEnvironment::setPromise("poll")));
+
+    sensorObject->setValue(11.0);
+
+    ASSERT_TRUE(DbusEnvironment::waitForFuture("poll"));
+}
+
+TEST_F(TestSamplingScheduler, rateLimitedSensorDeliversOnlyLatestValue)
+{
+    makeSensor({SamplingMode::signalRateLimited, 200ms});
+    registerForUpdates();
+
+    EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, 1.0))
+        .WillOnce(InvokeWithoutArgs(DbusEnvironment::setPromise("first")));
+
+    sensorObject->setValue(1.0);
+
+    ASSERT_TRUE(DbusEnvironment::waitForFuture("first"));
+
+    EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, 3.0))
+        .WillOnce(InvokeWithoutArgs(DbusEnvironment::setPromise("flush")));
+
+    sensorObject->setValue(2.0);
+    sensorObject->setValue(3.0);
+
+    ASSERT_TRUE(DbusEnvironment::waitForFuture("flush"));
+}
@@ -147,6 +147,20 @@ TEST_F(TestSensorNotification, notifiesListenerWithValueWhenChangeOccurs)
     ASSERT_TRUE(DbusEnvironment::waitForFuture("notify"));
 }
 
+TEST_F(TestSensorNotification, notifiesWithTimestampNotLaterThanHandling)
+{
+    EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), _, 42.7))
+        .WillOnce([this](auto&, Milliseconds updateTimestamp, double) {
+            EXPECT_THAT(updateTimestamp,
+                        AllOf(Ge(timestamp), Le(Clock().steadyTimestamp())));
+            DbusEnvironment::setPromise("notify")();
+        });
+
+    sensorObject->setValue(42.7);
+
+    ASSERT_TRUE(DbusEnvironment::waitForFuture("notify"));
+}
+
 TEST_F(TestSensorNotification, doesntNotifyListenerWhenNoChangeOccurs)
 {
     EXPECT_CALL(*listenerMock, sensorUpdated(Ref(*sut), Ge(timestamp), 42.7))
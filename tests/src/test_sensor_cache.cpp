@@ -106,3 +106,24 @@ TEST_F(TestSensorCache, shouldCreateSensorWithCorrespondingId)
 
     ASSERT_THAT(id, Eq(expected));
 }
+
+TEST_F(TestSensorCache, shouldKeepLiveSensorsWhenExpiredOnesAreCleanedUp)
+{
+    std::vector<std::shared_ptr<NiceMock<SensorMock>>> liveSensors;
+    for (size_t i = 0; i < 500; ++i)
+    {
+        auto sensor = sut.makeSensor<NiceMock<SensorMock>>(
+            "sensor-service", "sensor-path-" + std::to_string(i));
+        if (i % 2 == 0)
+        {
+            liveSensors.emplace_back(std::move(sensor));
+        }
+    }
+
+    for (size_t i = 0; i < liveSensors.size(); ++i)
+    {
+        auto sensor = sut.makeSensor<NiceMock<SensorMock>>(
+            "sensor-service", "sensor-path-" + std::to_string(2 * i));
+        EXPECT_THAT(sensor.get(), Eq(liveSensors[i].get()));
+    }
+}
@@ -0,0 +1,263 @@
+#include "dbus_environment.hpp"
+#include "helpers.hpp"
+#include "sensor_directory.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <sdbusplus/asio/object_server.hpp>
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/exception.hpp>
+
+#include <cerrno>
+#include <functional>
+#include <map>
+#include <optional>
+#include <thread>
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+/** Answers GetObject from its own connection and thread, so the blocking
+ *  lookups of the directory get a reply */
+class ObjectMapperStub
+{
+  public:
+    explicit ObjectMapperStub(std::map<std::string, std::string> objects)
+    {
+        bus->request_name(utils::ObjectMapper::default_service);
+        iface = objServer.add_interface(utils::ObjectMapper::instance_path,
+                                        utils::ObjectMapper::interface);
+        iface->register_method(
+            utils::ObjectMapper::method_names::get_object,
+            [objects = std::move(objects)](const std::string& path,
+                                           const std::vector<std::string>&) {
+                auto it = objects.find(path);
+                if (it == objects.end())
+                {
+                    throw sdbusplus::exception::SdBusError(ENOENT,
+                                                           "Not found");
+                }
+                return utils::SensorIfaces{
+                    {it->second, {utils::SensorValue::interface}}};
+            });
+        iface->initialize();
+        thread = std::jthread([this] { ioc.run(); });
+    }
+
+    ~ObjectMapperStub()
+    {
+        ioc.stop();
+    }
+
+    ObjectMapperStub(const ObjectMapperStub&) = delete;
+    ObjectMapperStub& operator=(const ObjectMapperStub&) = delete;
+
+  private:
+    boost::asio::io_context ioc;
+    std::shared_ptr<sdbusplus::asio::connection> bus =
+        std::make_shared<sdbusplus::asio::connection>(ioc);
+    sdbusplus::asio::object_server objServer{bus};
+    std::shared_ptr<sdbusplus::asio::dbus_interface> iface;
+    std::jthread thread;
+};
+
+class TestSensorDirectory : public Test
+{
+  public:
+    void TearDown() override
+    {
+        DbusEnvironment::synchronizeIoc();
+    }
+
+    static void emitInterfacesRemoved(const std::string& path,
+                                      const std::vector<std::string>& ifaces)
+    {
+        auto signal = DbusEnvironment::getBus()->new_signal(
+            "/", "org.freedesktop.DBus.ObjectManager", "InterfacesRemoved");
+        signal.append(sdbusplus::message::object_path(path), ifaces);
+        signal.signal_send();
+    }
+
+    static bool waitUntil(const std::function<bool()>& condition)
+    {
+        for (auto elapsed = 0ms; elapsed < 1000ms; elapsed += 10ms)
+        {
+            if (condition())
+            {
+                return true;
+            }
+            DbusEnvironment::sleepFor(10ms);
+        }
+        return false;
+    }
+
+    bool waitUntilRemoved(const std::string& path)
+    {
+        return waitUntil([this, &path] { return sut.find(path) == nullptr; });
+    }
+
+    const std::string sensorPath =
+        "/xyz/openbmc_project/sensors/temperature/ut_sensor";
+    SensorDirectory sut{DbusEnvironment::getBus()};
+};
+
+TEST_F(TestSensorDirectory, returnsNullForUnknownPath)
+{
+    EXPECT_THAT(sut.find(sensorPath), IsNull());
+}
+
+TEST_F(TestSensorDirectory, returnsServicesFromSensorTree)
+{
+    sut.update({{sensorPath, {{"service1", {"iface"}}}},
+                {sensorPath + "_2", {{"service1", {}}, {"service2", {}}}}});
+
+    ASSERT_THAT(sut.find(sensorPath), NotNull());
+    EXPECT_THAT(*sut.find(sensorPath), ElementsAre("service1"));
+    ASSERT_THAT(sut.find(sensorPath + "_2"), NotNull());
+    EXPECT_THAT(*sut.find(sensorPath + "_2"),
+                ElementsAre("service1", "service2"));
+}
+
+TEST_F(TestSensorDirectory, updateReplacesPreviousContent)
+{
+    sut.add(sensorPath, "service1");
+
+    sut.update({{sensorPath + "_2", {{"service2", {}}}}});
+
+    EXPECT_THAT(sut.find(sensorPath), IsNull());
+    EXPECT_THAT(sut.find(sensorPath + "_2"), NotNull());
+}
+
+TEST_F(TestSensorDirectory, addsEachServiceOnlyOnce)
+{
+    sut.add(sensorPath, "service1");
+    sut.add(sensorPath, "service1");
+    sut.add(sensorPath, "service2");
+
+    ASSERT_THAT(sut.find(sensorPath), NotNull());
+    EXPECT_THAT(*sut.find(sensorPath), ElementsAre("service1", "service2"));
+}
+
+TEST_F(TestSensorDirectory, resolvesMissingPathsWithObjectMapper)
+{
+    ObjectMapperStub mapper({{sensorPath, "service1"}});
+
+    sut.resolve({sensorPath, sensorPath + "_unknown"});
+
+    ASSERT_THAT(sut.find(sensorPath), NotNull());
+    EXPECT_THAT(*sut.find(sensorPath), ElementsAre("service1"));
+    EXPECT_THAT(sut.find(sensorPath + "_unknown"), IsNull());
+}
+
+TEST_F(TestSensorDirectory, doesNotResolveKnownPaths)
+{
+    ObjectMapperStub mapper({{sensorPath, "service1"}});
+    sut.add(sensorPath, "service2");
+
+    sut.resolve({sensorPath});
+
+    ASSERT_THAT(sut.find(sensorPath), NotNull());
+    EXPECT_THAT(*sut.find(sensorPath), ElementsAre("service2"));
+}
+
+TEST_F(TestSensorDirectory, removesSensor)
+{
+    sut.add(sensorPath, "service1");
+
+    sut.remove(sensorPath, "service1");
+
+    EXPECT_THAT(sut.find(sensorPath), IsNull());
+}
+
+TEST_F(TestSensorDirectory, keepsSensorHostedByOtherService)
+{
+    sut.add(sensorPath, "service1");
+    sut.add(sensorPath, "service2");
+
+    sut.remove(sensorPath, "service1");
+
+    ASSERT_THAT(sut.find(sensorPath), NotNull());
+    EXPECT_THAT(*sut.find(sensorPath), ElementsAre("service2"));
+}
+
+TEST_F(TestSensorDirectory, removesServiceFromAllSensors)
+{
+    sut.add(sensorPath, "service1");
+    sut.add(sensorPath, "service2");
+    sut.add(sensorPath + "_2", "service1");
+
+    sut.removeService("service1");
+
+    ASSERT_THAT(sut.find(sensorPath), NotNull());
+    EXPECT_THAT(*sut.find(sensorPath), ElementsAre("service2"));
+    EXPECT_THAT(sut.find(sensorPath + "_2"), IsNull());
+}
+
+TEST_F(TestSensorDirectory, removesSensorOnInterfacesRemovedSignal)
+{
+    sut.add(sensorPath, DbusEnvironment::serviceName());
+    DbusEnvironment::sleepFor(100ms);
+
+    emitInterfacesRemoved(sensorPath,
+                          {"xyz.openbmc_project.Sensor.Value",
+                           "xyz.openbmc_project.Association.Definitions"});
+
+    EXPECT_TRUE(waitUntilRemoved(sensorPath));
+}
+
+TEST_F(TestSensorDirectory, removesOnlySenderServiceOnInterfacesRemovedSignal)
+{
+    sut.add(sensorPath, DbusEnvironment::serviceName());
+    sut.add(sensorPath, "service1");
+    DbusEnvironment::sleepFor(100ms);
+
+    emitInterfacesRemoved(sensorPath, {"xyz.openbmc_project.Sensor.Value"});
+
+    EXPECT_TRUE(waitUntil([this] {
+        const auto* services = sut.find(sensorPath);
+        return services != nullptr && services->size() == 1;
+    }));
+    ASSERT_THAT(sut.find(sensorPath), NotNull());
+    EXPECT_THAT(*sut.find(sensorPath), ElementsAre("service1"));
+}
+
+TEST_F(TestSensorDirectory, removesSensorsOfServiceLeavingTheBus)
+{
+    const std::string service = "telemetry.ut.sensors";
+    auto sensorService = std::make_optional(sdbusplus::bus::new_bus());
+    sensorService->request_name(service.c_str());
+
+    sut.add(sensorPath, service);
+    sut.add(sensorPath, "service1");
+    sut.add(sensorPath + "_2", service);
+
+    sensorService = std::nullopt;
+
+    EXPECT_TRUE(waitUntilRemoved(sensorPath + "_2"));
+    ASSERT_THAT(sut.find(sensorPath), NotNull());
+    EXPECT_THAT(*sut.find(sensorPath), ElementsAre("service1"));
+}
+
+TEST_F(TestSensorDirectory, removesSensorsOfUniqueNameLeavingTheBus)
+{
+    auto sensorService = std::make_optional(sdbusplus::bus::new_bus());
+
+    sut.add(sensorPath, sensorService->get_unique_name());
+
+    sensorService = std::nullopt;
+
+    EXPECT_TRUE(waitUntilRemoved(sensorPath));
+}
+
+TEST_F(TestSensorDirectory, keepsSensorWhenValueInterfaceIsNotRemoved)
+{
+    sut.add(sensorPath, DbusEnvironment::serviceName());
+    DbusEnvironment::sleepFor(100ms);
+
+    emitInterfacesRemoved(sensorPath,
+                          {"xyz.openbmc_project.Association.Definitions"});
+    DbusEnvironment::sleepFor(100ms);
+
+    EXPECT_THAT(sut.find(sensorPath), NotNull());
+}
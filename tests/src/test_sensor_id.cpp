@@ -0,0 +1,50 @@
+#include "helpers.hpp"
+#include "types/sensor_id.hpp"
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+TEST(TestSensorId, sameComponentsShareHandle)
+{
+    SensorId id1("type", "service", "/path");
+    SensorId id2("type", std::string("service"), "/path");
+
+    EXPECT_THAT(id1.handle(), Eq(id2.handle()));
+    EXPECT_THAT(id1.hash(), Eq(id2.hash()));
+    EXPECT_THAT(id1, Eq(id2));
+}
+
+TEST(TestSensorId, differentComponentsGiveDifferentHandles)
+{
+    SensorId id("type", "service", "/path");
+
+    EXPECT_THAT(SensorId("type2", "service", "/path"), Ne(id));
+    EXPECT_THAT(SensorId("type", "service2", "/path"), Ne(id));
+    EXPECT_THAT(SensorId("type", "service", "/path2"), Ne(id));
+    EXPECT_THAT(SensorId("typeservice", "", "/path"), Ne(id));
+}
+
+TEST(TestSensorId, returnsInternedComponents)
+{
+    SensorId id("type", "service", "/path");
+
+    EXPECT_THAT(id.type(), Eq("type"));
+    EXPECT_THAT(id.service(), Eq("service"));
+    EXPECT_THAT(id.path(), Eq("/path"));
+    EXPECT_THAT(id.str(), Eq("type:service:/path"));
+}
+
+TEST(TestSensorId, componentsStayValidWhenTableGrows)
+{
+    SensorId id("type", "service", "/stable/path");
+    const std::string* path = &id.path();
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        SensorId("type", "service", "/path" + std::to_string(i));
+    }
+
+    EXPECT_THAT(&id.path(), Eq(path));
+    EXPECT_THAT(*path, Eq("/stable/path"));
+}
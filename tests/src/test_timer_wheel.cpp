@@ -0,0 +1,120 @@
+#include "dbus_environment.hpp"
+#include "helpers.hpp"
+#include "utils/timer_wheel.hpp"
+
+#include <gmock/gmock.h>
+
+#include <optional>
+#include <thread>
+
+namespace utils
+{
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+class TestTimerWheel : public Test
+{
+  public:
+    TimerWheel sut{DbusEnvironment::getIoc()};
+    uint32_t value = 0;
+};
+
+TEST_F(TestTimerWheel, firesCallbackNotEarlierThanDelay)
+{
+    auto setPromise = DbusEnvironment::setPromise("timer");
+    TimerWheel::Timer timer(sut, [this, &setPromise] {
+        ++value;
+        setPromise();
+    });
+
+    auto elapsed = DbusEnvironment::measureTime([&timer] {
+        timer.start(100ms);
+        DbusEnvironment::waitForFuture("timer");
+    });
+
+    EXPECT_THAT(elapsed, AllOf(Ge(100ms), Lt(200ms)));
+    EXPECT_THAT(value, Eq(1u));
+    EXPECT_THAT(sut.pending(), Eq(0u));
+}
+
+TEST_F(TestTimerWheel, cancelledTimerDoesNotFire)
+{
+    TimerWheel::Timer timer(sut, [this] { ++value; });
+
+    timer.start(10ms);
+    timer.cancel();
+    DbusEnvironment::sleepFor(50ms);
+
+    EXPECT_THAT(timer.isPending(), Eq(false));
+    EXPECT_THAT(value, Eq(0u));
+}
+
+TEST_F(TestTimerWheel, restartPostponesExpiry)
+{
+    TimerWheel::Timer timer(sut, [this] { ++value; });
+
+    timer.start(40ms);
+    DbusEnvironment::sleepFor(20ms);
+    timer.start(100ms);
+    DbusEnvironment::sleepFor(50ms);
+
+    EXPECT_THAT(value, Eq(0u));
+    EXPECT_THAT(sut.pending(), Eq(1u));
+}
+
+TEST_F(TestTimerWheel, destroyedTimerIsRemovedFromWheel)
+{
+    {
+        TimerWheel::Timer timer(sut, [this] { ++value; });
+        timer.start(10ms);
+    }
+    DbusEnvironment::sleepFor(50ms);
+
+    EXPECT_THAT(sut.pending(), Eq(0u));
+    EXPECT_THAT(value, Eq(0u));
+}
+
+TEST_F(TestTimerWheel, firesTimersLongerThanOneRevolution)
+{
+    const auto delay = TimerWheel::resolution * TimerWheel::slotCount + 20ms;
+    auto setPromise = DbusEnvironment::setPromise("timer");
+    TimerWheel::Timer shortTimer(sut, [this] { ++value; });
+    TimerWheel::Timer longTimer(sut, [&setPromise] { setPromise(); });
+
+    auto elapsed = DbusEnvironment::measureTime([&] {
+        longTimer.start(delay);
+        shortTimer.start(20ms);
+        DbusEnvironment::waitForFuture("timer");
+    });
+
+    EXPECT_THAT(elapsed, Ge(delay));
+    EXPECT_THAT(value, Eq(1u));
+}
+
+TEST_F(TestTimerWheel, callbackCanCancelOtherExpiredTimer)
+{
+    auto setPromise = DbusEnvironment::setPromise("timer");
+    std::optional<TimerWheel::Timer> first;
+    std::optional<TimerWheel::Timer> second;
+    first.emplace(sut, [this, &second] {
+        ++value;
+        second->cancel();
+    });
+    second.emplace(sut, [this, &first] {
+        ++value;
+        first->cancel();
+    });
+    TimerWheel::Timer last(sut, [&setPromise] { setPromise(); });
+
+    first->start(10ms);
+    second->start(10ms);
+    last.start(30ms);
+    std::this_thread::sleep_for(20ms);
+    DbusEnvironment::waitForFuture("timer");
+
+    EXPECT_THAT(value, Eq(1u));
+    EXPECT_THAT(sut.pending(), Eq(0u));
+}
+
+} // namespace utils
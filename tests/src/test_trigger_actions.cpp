@@ -1,4 +1,5 @@
 #include "dbus_environment.hpp"
+#include "fakes/clock_fake.hpp"
 #include "helpers.hpp"
 #include "messages/update_report_ind.hpp"
 #include "trigger_actions.hpp"
@@ -52,7 +53,7 @@ class TestActionNumeric : public Test, public WithParamInterface<LogParam>
     void SetUp() override
     {
         auto [type, threshold, value] = GetParam();
-        sut = std::make_unique<ActionType>(type, threshold);
+        sut = std::make_unique<ActionType>(eventLogQueue, type, threshold);
         commmitValue = value;
     }
 
@@ -62,6 +63,9 @@ class TestActionNumeric : public Test, public WithParamInterface<LogParam>
                     Milliseconds{100'000}, commmitValue);
     }
 
+    EventLogQueue eventLogQueue{DbusEnvironment::getIoc(),
+                                EventLogQueue::defaultLimits(),
+                                std::make_unique<ClockFake>()};
     std::unique_ptr<ActionType> sut;
     TriggerValue commmitValue;
 };
@@ -78,6 +82,13 @@ TEST_P(TestLogToRedfishEventLogNumeric, commitExpectNoThrow)
     EXPECT_NO_THROW(commit());
 }
 
+TEST_P(TestLogToRedfishEventLogNumeric, commitQueuesEventForFlush)
+{
+    commit();
+
+    EXPECT_THAT(eventLogQueue.size(), Eq(1u));
+}
+
 class TestLogToRedfishEventLogNumericThrow :
     public TestLogToRedfishEventLogNumeric
 {};
@@ -100,7 +111,7 @@ class TestLogToRedfishEventLogDiscrete : public Test
   public:
     void SetUp()
     {
-        sut = std::make_unique<LogToRedfishEventLog>();
+        sut = std::make_unique<LogToRedfishEventLog>(eventLogQueue);
     }
 
     void commit(TriggerValue value) const
@@ -110,6 +121,9 @@ class TestLogToRedfishEventLogDiscrete : public Test
                     Milliseconds{100'000}, value);
     }
 
+    EventLogQueue eventLogQueue{DbusEnvironment::getIoc(),
+                                EventLogQueue::defaultLimits(),
+                                std::make_unique<ClockFake>()};
     std::unique_ptr<LogToRedfishEventLog> sut;
 };
 
@@ -132,7 +146,7 @@ class TestActionOnChange : public Test
   public:
     void SetUp() override
     {
-        sut = std::make_unique<ActionType>();
+        sut = std::make_unique<ActionType>(eventLogQueue);
     }
 
     void commit(TriggerValue value)
@@ -141,6 +155,9 @@ class TestActionOnChange : public Test
                     Milliseconds{100'000}, value);
     }
 
+    EventLogQueue eventLogQueue{DbusEnvironment::getIoc(),
+                                EventLogQueue::defaultLimits(),
+                                std::make_unique<ClockFake>()};
     std::unique_ptr<ActionType> sut;
 };
 
@@ -92,6 +92,23 @@ TEST_F(TestTriggerManager, addTrigger)
     EXPECT_THAT(path, Eq(triggerMock.getPath()));
 }
 
+TEST_F(TestTriggerManager, exposesEventLogCounters)
+{
+    ON_CALL(triggerFactoryMock, getEventLogCounters())
+        .WillByDefault(Return(EventLogCounters{
+            .logged = 7, .suppressed = 3, .dropped = 1}));
+
+    const auto getCounter = [](const std::string& property) {
+        return DbusEnvironment::getProperty<uint64_t>(
+            TriggerManager::triggerManagerPath,
+            TriggerManager::eventLogInterface, property);
+    };
+
+    EXPECT_THAT(getCounter("LoggedEvents"), Eq(7u));
+    EXPECT_THAT(getCounter("SuppressedEvents"), Eq(3u));
+    EXPECT_THAT(getCounter("DroppedEvents"), Eq(1u));
+}
+
 TEST_F(TestTriggerManager, addTriggerWithDiscreteThresholds)
 {
     TriggerParams triggerParamsDiscrete;
@@ -0,0 +1,186 @@
+#include "config.hpp"
+
+#include <getopt.h>
+
+#include <charconv>
+#include <iostream>
+#include <string_view>
+
+namespace loadgen
+{
+
+namespace
+{
+
+void printUsage(const char* name)
+{
+    std::cerr
+        << "Usage: " << name << " [options]\n"
+        << "  --sensors N              number of hosted sensors (1000)\n"
+        << "  --reports N              number of reports to add (10)\n"
+        << "  --metrics-per-report N   sensors referenced by each report "
+           "(100)\n"
+        << "  --triggers N             number of triggers to add (10)\n"
+        << "  --sensors-per-trigger N  sensors watched by each trigger (10)\n"
+        << "  --rate HZ                updates per second per sensor (1)\n"
+        << "  --pattern NAME           random-walk, square-wave or burst\n"
+        << "  --burst-size N           updates sent per burst (10)\n"
+        << "  --reporting-type NAME    OnChange or Periodic (OnChange)\n"
+        << "  --interval MS            interval of periodic reports (1000)\n"
+        << "  --warmup S               seconds before measuring starts (2)\n"
+        << "  --duration S             seconds of measurement (30)\n"
+        << "  --no-object-mapper       rely on an existing ObjectMapper\n"
+        << "  --output FILE            write JSON results to FILE\n";
+}
+
+template <class T>
+bool parseNumber(std::string_view text, T& out)
+{
+    const auto [ptr, ec] =
+        std::from_chars(text.data(), text.data() + text.size(), out);
+    return ec == std::errc() && ptr == text.data() + text.size();
+}
+
+std::optional<Pattern> parsePattern(std::string_view text)
+{
+    if (text == "random-walk")
+    {
+        return Pattern::randomWalk;
+    }
+    if (text == "square-wave")
+    {
+        return Pattern::squareWave;
+    }
+    if (text == "burst")
+    {
+        return Pattern::burst;
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+std::optional<Config> parseArgs(int argc, char** argv)
+{
+    enum Option : int
+    {
+        sensors = 256,
+        reports,
+        metricsPerReport,
+        triggers,
+        sensorsPerTrigger,
+        rate,
+        pattern,
+        burstSize,
+        reportingType,
+        interval,
+        warmup,
+        duration,
+        noObjectMapper,
+        output,
+        help
+    };
+
+    const option options[] = {
+        {"sensors", required_argument, nullptr, sensors},
+        {"reports", required_argument, nullptr, reports},
+        {"metrics-per-report", required_argument, nullptr, metricsPerReport},
+        {"triggers", required_argument, nullptr, triggers},
+        {"sensors-per-trigger", required_argument, nullptr, sensorsPerTrigger},
+        {"rate", required_argument, nullptr, rate},
+        {"pattern", required_argument, nullptr, pattern},
+        {"burst-size", required_argument, nullptr, burstSize},
+        {"reporting-type", required_argument, nullptr, reportingType},
+        {"interval", required_argument, nullptr, interval},
+        {"warmup", required_argument, nullptr, warmup},
+        {"duration", required_argument, nullptr, duration},
+        {"no-object-mapper", no_argument, nullptr, noObjectMapper},
+        {"output", required_argument, nullptr, output},
+        {"help", no_argument, nullptr, help},
+        {nullptr, 0, nullptr, 0}};
+
+    Config config;
+    int opt = 0;
+    while ((opt = getopt_long(argc, argv, "", options, nullptr)) != -1)
+    {
+        const std::string_view arg = optarg ? optarg : "";
+        bool valid = true;
+        uint64_t seconds = 0;
+
+        switch (opt)
+        {
+            case sensors:
+                valid = parseNumber(arg, config.sensors) && config.sensors > 0;
+                break;
+            case reports:
+                valid = parseNumber(arg, config.reports);
+                break;
+            case metricsPerReport:
+                valid = parseNumber(arg, config.metricsPerReport);
+                break;
+            case triggers:
+                valid = parseNumber(arg, config.triggers);
+                break;
+            case sensorsPerTrigger:
+                valid = parseNumber(arg, config.sensorsPerTrigger);
+                break;
+            case rate:
+                valid = parseNumber(arg, config.rate) && config.rate > 0.0;
+                break;
+            case pattern:
+                if (auto value = parsePattern(arg))
+                {
+                    config.pattern = *value;
+                }
+                else
+                {
+                    valid = false;
+                }
+                break;
+            case burstSize:
+                valid = parseNumber(arg, config.burstSize) &&
+                        config.burstSize > 0;
+                break;
+            case reportingType:
+                config.reportingType = arg;
+                valid = arg == "OnChange" || arg == "Periodic";
+                break;
+            case interval:
+                valid = parseNumber(arg, config.interval);
+                break;
+            case warmup:
+                valid = parseNumber(arg, seconds);
+                config.warmup = std::chrono::seconds(seconds);
+                break;
+            case duration:
+                valid = parseNumber(arg, seconds);
+                config.duration = std::chrono::seconds(seconds);
+                break;
+            case noObjectMapper:
+                config.hostObjectMapper = false;
+                break;
+            case output:
+                config.output = arg;
+                break;
+            default:
+                valid = false;
+                break;
+        }
+
+        if (!valid)
+        {
+            printUsage(argv[0]);
+            return std::nullopt;
+        }
+    }
+
+    if (optind != argc)
+    {
+        printUsage(argv[0]);
+        return std::nullopt;
+    }
+
+    return config;
+}
+
+} // namespace loadgen
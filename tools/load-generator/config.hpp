@@ -0,0 +1,39 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace loadgen
+{
+
+enum class Pattern
+{
+    randomWalk,
+    squareWave,
+    burst
+};
+
+struct Config
+{
+    size_t sensors = 1000;
+    size_t reports = 10;
+    size_t metricsPerReport = 100;
+    size_t triggers = 10;
+    size_t sensorsPerTrigger = 10;
+    double rate = 1.0;
+    Pattern pattern = Pattern::randomWalk;
+    size_t burstSize = 10;
+    std::string reportingType = "OnChange";
+    uint64_t interval = 1000;
+    std::chrono::seconds warmup{2};
+    std::chrono::seconds duration{30};
+    bool hostObjectMapper = true;
+    std::string output;
+};
+
+std::optional<Config> parseArgs(int argc, char** argv);
+
+} // namespace loadgen
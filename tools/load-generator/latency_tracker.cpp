@@ -0,0 +1,112 @@
+#include "latency_tracker.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace loadgen
+{
+
+LatencyTracker::LatencyTracker(size_t sensorCount) : sensors(sensorCount) {}
+
+void LatencyTracker::track(size_t sensor)
+{
+    sensors.at(sensor).tracked = true;
+}
+
+void LatencyTracker::setEnabled(bool value)
+{
+    enabled = value;
+}
+
+void LatencyTracker::sent(size_t sensor, double value,
+                          Clock::time_point timestamp)
+{
+    auto& entry = sensors.at(sensor);
+    if (!enabled || !entry.tracked)
+    {
+        return;
+    }
+
+    if (entry.pending.size() == maxPending)
+    {
+        entry.pending.pop_front();
+        ++droppedCount;
+    }
+    entry.pending.push_back(Pending{value, timestamp});
+    ++sentCount;
+}
+
+void LatencyTracker::observed(size_t sensor, double value,
+                              Clock::time_point timestamp)
+{
+    if (sensor >= sensors.size())
+    {
+        return;
+    }
+
+    auto& entry = sensors[sensor];
+    if (entry.lastObserved == value)
+    {
+        return;
+    }
+    entry.lastObserved = value;
+
+    auto it = std::find_if(
+        entry.pending.begin(), entry.pending.end(),
+        [value](const Pending& pending) { return pending.value == value; });
+    if (it == entry.pending.end())
+    {
+        return;
+    }
+
+    droppedCount += static_cast<uint64_t>(
+        std::distance(entry.pending.begin(), it));
+    latenciesUs.push_back(
+        std::chrono::duration<double, std::micro>(timestamp - it->sentAt)
+            .count());
+    entry.pending.erase(entry.pending.begin(), std::next(it));
+}
+
+void LatencyTracker::finish()
+{
+    for (auto& entry : sensors)
+    {
+        droppedCount += entry.pending.size();
+        entry.pending.clear();
+    }
+    enabled = false;
+}
+
+LatencyTracker::Summary LatencyTracker::summary() const
+{
+    Summary result;
+    result.sent = sentCount;
+    result.delivered = latenciesUs.size();
+    result.dropped = droppedCount;
+
+    if (latenciesUs.empty())
+    {
+        return result;
+    }
+
+    auto sorted = latenciesUs;
+    std::sort(sorted.begin(), sorted.end());
+
+    const auto percentile = [&sorted](double p) {
+        const auto index = static_cast<size_t>(
+            p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[index];
+    };
+
+    result.minUs = sorted.front();
+    result.maxUs = sorted.back();
+    result.meanUs = std::accumulate(sorted.begin(), sorted.end(), 0.0) /
+                    static_cast<double>(sorted.size());
+    result.p50Us = percentile(0.50);
+    result.p90Us = percentile(0.90);
+    result.p99Us = percentile(0.99);
+
+    return result;
+}
+
+} // namespace loadgen
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <vector>
+
+namespace loadgen
+{
+
+/** Matches values published by sensors with values seen in report readings.
+ *
+ * A published value that is superseded by a newer one before it shows up in
+ * any report, or that never shows up at all, is counted as dropped.
+ */
+class LatencyTracker
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Summary
+    {
+        uint64_t sent = 0;
+        uint64_t delivered = 0;
+        uint64_t dropped = 0;
+        double minUs = 0.0;
+        double meanUs = 0.0;
+        double p50Us = 0.0;
+        double p90Us = 0.0;
+        double p99Us = 0.0;
+        double maxUs = 0.0;
+    };
+
+    explicit LatencyTracker(size_t sensorCount);
+
+    void track(size_t sensor);
+    void setEnabled(bool value);
+    void sent(size_t sensor, double value, Clock::time_point timestamp);
+    void observed(size_t sensor, double value, Clock::time_point timestamp);
+    void finish();
+
+    Summary summary() const;
+
+  private:
+    static constexpr size_t maxPending = 4096;
+
+    struct Pending
+    {
+        double value;
+        Clock::time_point sentAt;
+    };
+
+    struct SensorEntry
+    {
+        bool tracked = false;
+        std::optional<double> lastObserved;
+        std::deque<Pending> pending;
+    };
+
+    bool enabled = false;
+    uint64_t sentCount = 0;
+    uint64_t droppedCount = 0;
+    std::vector<SensorEntry> sensors;
+    std::vector<double> latenciesUs;
+};
+
+} // namespace loadgen
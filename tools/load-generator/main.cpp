@@ -0,0 +1,167 @@
+#include "config.hpp"
+#include "latency_tracker.hpp"
+#include "object_mapper_stub.hpp"
+#include "process_stats.hpp"
+#include "sensor_farm.hpp"
+#include "telemetry_client.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/signal_set.hpp>
+#include <boost/asio/spawn.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <nlohmann/json.hpp>
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/asio/object_server.hpp>
+#include <xyz/openbmc_project/ObjectMapper/common.hpp>
+#include <xyz/openbmc_project/Sensor/Value/common.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <optional>
+
+using namespace loadgen;
+using ObjectMapper = sdbusplus::common::xyz::openbmc_project::ObjectMapper;
+using SensorValue = sdbusplus::common::xyz::openbmc_project::sensor::Value;
+
+namespace
+{
+
+constexpr const char* serviceName =
+    "xyz.openbmc_project.TelemetryLoadGenerator";
+constexpr auto drainTime = std::chrono::seconds(1);
+
+void sleepFor(boost::asio::io_context& ioc, std::chrono::nanoseconds duration,
+              boost::asio::yield_context yield)
+{
+    boost::asio::steady_timer timer(ioc, duration);
+    timer.async_wait(yield);
+}
+
+nlohmann::json makeResult(const Config& config, const SensorFarm& farm,
+                          const TelemetryClient& client,
+                          const LatencyTracker::Summary& latency,
+                          const ProcessStats::Summary& process)
+{
+    nlohmann::json result;
+    result["config"] = {{"sensors", config.sensors},
+                        {"reports", config.reports},
+                        {"metricsPerReport", config.metricsPerReport},
+                        {"triggers", config.triggers},
+                        {"sensorsPerTrigger", config.sensorsPerTrigger},
+                        {"rate", config.rate},
+                        {"reportingType", config.reportingType},
+                        {"durationSeconds", config.duration.count()}};
+    result["updates"] = {{"published", farm.publishedUpdates()},
+                         {"tracked", latency.sent},
+                         {"delivered", latency.delivered},
+                         {"dropped", latency.dropped},
+                         {"readingsSignals", client.receivedReadingsSignals()}};
+    result["latencyUs"] = {{"min", latency.minUs}, {"mean", latency.meanUs},
+                           {"p50", latency.p50Us}, {"p90", latency.p90Us},
+                           {"p99", latency.p99Us}, {"max", latency.maxUs}};
+    result["telemetry"] = {{"cpuPercentMean", process.cpuPercentMean},
+                           {"cpuPercentMax", process.cpuPercentMax},
+                           {"rssKiBStart", process.rssKiBStart},
+                           {"rssKiBEnd", process.rssKiBEnd},
+                           {"rssKiBPeak", process.rssKiBPeak}};
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto config = parseArgs(argc, argv);
+    if (!config)
+    {
+        return 1;
+    }
+
+    boost::asio::io_context ioc;
+    auto bus = std::make_shared<sdbusplus::asio::connection>(ioc);
+    auto objServer = std::make_shared<sdbusplus::asio::object_server>(bus);
+    objServer->add_manager(SensorValue::namespace_path::value);
+
+    LatencyTracker tracker(config->sensors);
+    SensorFarm farm(ioc, objServer, *config, tracker);
+
+    std::optional<ObjectMapperStub> mapper;
+    if (config->hostObjectMapper)
+    {
+        mapper.emplace(objServer, serviceName, farm.paths());
+        bus->request_name(ObjectMapper::default_service);
+    }
+    bus->request_name(serviceName);
+
+    TelemetryClient client(bus, *config, tracker);
+
+    int exitCode = 0;
+    boost::asio::spawn(
+        ioc,
+        [&](boost::asio::yield_context yield) {
+            client.waitForService(yield);
+            ProcessStats stats(client.servicePid(yield));
+
+            std::cerr << "Adding " << config->reports << " reports and "
+                      << config->triggers << " triggers\n";
+            client.addReports(yield);
+            client.addTriggers(yield);
+
+            farm.start();
+            sleepFor(ioc, config->warmup, yield);
+
+            std::cerr << "Measuring for " << config->duration.count()
+                      << " s\n";
+            tracker.setEnabled(true);
+            stats.start();
+            for (auto elapsed = std::chrono::seconds(0);
+                 elapsed < config->duration; ++elapsed)
+            {
+                sleepFor(ioc, std::chrono::seconds(1), yield);
+                stats.sample();
+            }
+
+            farm.stop();
+            sleepFor(ioc, drainTime, yield);
+            tracker.finish();
+            stats.sample();
+
+            const auto result = makeResult(*config, farm, client,
+                                           tracker.summary(), stats.summary());
+            if (config->output.empty())
+            {
+                std::cout << result.dump(4) << "\n";
+            }
+            else
+            {
+                std::ofstream(config->output) << result.dump(4) << "\n";
+            }
+
+            client.removeAll(yield);
+            ioc.stop();
+        },
+        [&ioc, &exitCode](std::exception_ptr e) {
+            if (e)
+            {
+                try
+                {
+                    std::rethrow_exception(e);
+                }
+                catch (const std::exception& ex)
+                {
+                    std::cerr << "Load test failed: " << ex.what() << "\n";
+                }
+                exitCode = 1;
+                ioc.stop();
+            }
+        });
+
+    boost::asio::signal_set signals(ioc, SIGINT, SIGTERM);
+    signals.async_wait([&ioc](const boost::system::error_code, int) {
+        ioc.stop();
+    });
+
+    ioc.run();
+
+    return exitCode;
+}
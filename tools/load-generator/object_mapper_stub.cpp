@@ -0,0 +1,69 @@
+#include "object_mapper_stub.hpp"
+
+#include <sdbusplus/exception.hpp>
+#include <xyz/openbmc_project/ObjectMapper/common.hpp>
+#include <xyz/openbmc_project/Sensor/Value/common.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <map>
+
+namespace loadgen
+{
+
+using ObjectMapper = sdbusplus::common::xyz::openbmc_project::ObjectMapper;
+using SensorValue = sdbusplus::common::xyz::openbmc_project::sensor::Value;
+
+ObjectMapperStub::ObjectMapperStub(
+    const std::shared_ptr<sdbusplus::asio::object_server>& objServer,
+    std::string serviceIn, std::vector<std::string> sensorPathsIn) :
+    objServer(objServer), service(std::move(serviceIn)),
+    sensorPaths(std::move(sensorPathsIn))
+{
+    using SubTree =
+        std::map<std::string, std::map<std::string, std::vector<std::string>>>;
+
+    mapperIface = objServer->add_interface(ObjectMapper::instance_path,
+                                           ObjectMapper::interface);
+    mapperIface->register_method(
+        ObjectMapper::method_names::get_sub_tree,
+        [this](const std::string& subtree, int32_t,
+               const std::vector<std::string>& interfaces) {
+            SubTree result;
+            if (!interfaces.empty() &&
+                std::find(interfaces.begin(), interfaces.end(),
+                          SensorValue::interface) == interfaces.end())
+            {
+                return result;
+            }
+
+            for (const auto& path : sensorPaths)
+            {
+                if (path.starts_with(subtree))
+                {
+                    result[path][service] = {SensorValue::interface};
+                }
+            }
+            return result;
+        });
+    mapperIface->register_method(
+        ObjectMapper::method_names::get_object,
+        [this](const std::string& path, const std::vector<std::string>&) {
+            if (std::find(sensorPaths.begin(), sensorPaths.end(), path) ==
+                sensorPaths.end())
+            {
+                throw sdbusplus::exception::SdBusError(
+                    ENOENT, "Object not found");
+            }
+            return std::map<std::string, std::vector<std::string>>{
+                {service, {SensorValue::interface}}};
+        });
+    mapperIface->initialize();
+}
+
+ObjectMapperStub::~ObjectMapperStub()
+{
+    objServer->remove_interface(mapperIface);
+}
+
+} // namespace loadgen
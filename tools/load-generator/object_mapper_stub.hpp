@@ -0,0 +1,32 @@
+#pragma once
+
+#include <sdbusplus/asio/object_server.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace loadgen
+{
+
+/** Minimal xyz.openbmc_project.ObjectMapper answering sensor lookups for a
+ *  plain Linux box where no mapper is running. */
+class ObjectMapperStub
+{
+  public:
+    ObjectMapperStub(
+        const std::shared_ptr<sdbusplus::asio::object_server>& objServer,
+        std::string service, std::vector<std::string> sensorPaths);
+    ~ObjectMapperStub();
+
+    ObjectMapperStub(const ObjectMapperStub&) = delete;
+    ObjectMapperStub& operator=(const ObjectMapperStub&) = delete;
+
+  private:
+    std::shared_ptr<sdbusplus::asio::object_server> objServer;
+    std::shared_ptr<sdbusplus::asio::dbus_interface> mapperIface;
+    std::string service;
+    std::vector<std::string> sensorPaths;
+};
+
+} // namespace loadgen
@@ -0,0 +1,103 @@
+#include "process_stats.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace loadgen
+{
+
+ProcessStats::ProcessStats(pid_t pid) : pid(pid) {}
+
+void ProcessStats::start()
+{
+    if (auto cpu = readCpuSeconds())
+    {
+        first = previous = Sample{Clock::now(), *cpu};
+    }
+    result = Summary{};
+    result.rssKiBStart = result.rssKiBPeak = readRssKiB().value_or(0);
+}
+
+void ProcessStats::sample()
+{
+    const auto cpu = readCpuSeconds();
+    if (!cpu || !previous)
+    {
+        return;
+    }
+
+    const auto now = Clock::now();
+    const auto percent = [&cpu, &now](const Sample& since) {
+        const double wall =
+            std::chrono::duration<double>(now - since.timestamp).count();
+        return wall > 0.0 ? 100.0 * (*cpu - since.cpuSeconds) / wall : 0.0;
+    };
+
+    result.cpuPercentMax = std::max(result.cpuPercentMax, percent(*previous));
+    result.cpuPercentMean = percent(*first);
+    previous = Sample{now, *cpu};
+
+    if (auto rss = readRssKiB())
+    {
+        result.rssKiBEnd = *rss;
+        result.rssKiBPeak = std::max(result.rssKiBPeak, *rss);
+    }
+}
+
+std::optional<double> ProcessStats::readCpuSeconds() const
+{
+    std::ifstream file("/proc/" + std::to_string(pid) + "/stat");
+    std::string content;
+    if (!std::getline(file, content))
+    {
+        return std::nullopt;
+    }
+
+    // The command name may contain spaces, fields are counted after it.
+    const auto commEnd = content.rfind(')');
+    if (commEnd == std::string::npos)
+    {
+        return std::nullopt;
+    }
+
+    std::istringstream fields(content.substr(commEnd + 2));
+    std::string field;
+    uint64_t utime = 0;
+    uint64_t stime = 0;
+    // Fields 3..13 precede utime (14) and stime (15).
+    for (int i = 3; i <= 13 && fields >> field; ++i)
+    {}
+    if (!(fields >> utime >> stime))
+    {
+        return std::nullopt;
+    }
+
+    static const auto ticksPerSecond = sysconf(_SC_CLK_TCK);
+    return static_cast<double>(utime + stime) /
+           static_cast<double>(ticksPerSecond);
+}
+
+std::optional<uint64_t> ProcessStats::readRssKiB() const
+{
+    std::ifstream file("/proc/" + std::to_string(pid) + "/status");
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.starts_with("VmRSS:"))
+        {
+            std::istringstream fields(line.substr(6));
+            uint64_t value = 0;
+            if (fields >> value)
+            {
+                return value;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace loadgen
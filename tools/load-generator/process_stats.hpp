@@ -0,0 +1,53 @@
+#pragma once
+
+#include <sys/types.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace loadgen
+{
+
+/** Samples CPU time and resident memory of a process from /proc. */
+class ProcessStats
+{
+  public:
+    struct Summary
+    {
+        double cpuPercentMean = 0.0;
+        double cpuPercentMax = 0.0;
+        uint64_t rssKiBStart = 0;
+        uint64_t rssKiBEnd = 0;
+        uint64_t rssKiBPeak = 0;
+    };
+
+    explicit ProcessStats(pid_t pid);
+
+    void start();
+    void sample();
+
+    const Summary& summary() const
+    {
+        return result;
+    }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Sample
+    {
+        Clock::time_point timestamp;
+        double cpuSeconds;
+    };
+
+    std::optional<double> readCpuSeconds() const;
+    std::optional<uint64_t> readRssKiB() const;
+
+    pid_t pid;
+    std::optional<Sample> first;
+    std::optional<Sample> previous;
+    Summary result;
+};
+
+} // namespace loadgen
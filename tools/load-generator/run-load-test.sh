@@ -0,0 +1,67 @@
+#!/bin/bash
+#
+# Runs telemetry against the load generator on a private dbus-daemon.
+#
+# Usage: run-load-test.sh <path to telemetry> [load generator options]
+#
+# The load generator binary is expected next to this script, which is where
+# meson places both of them when built with -Dbuildtools=true.
+
+set -euo pipefail
+
+if [[ $# -lt 1 ]]; then
+    echo "Usage: $0 <path to telemetry> [load generator options]" >&2
+    exit 1
+fi
+
+telemetry="$(realpath "$1")"
+shift
+loadgen="$(dirname "$(realpath "$0")")/telemetry-load-generator"
+
+workdir="$(mktemp -d)"
+cleanup() {
+    [[ -n "${telemetry_pid:-}" ]] && kill "${telemetry_pid}" 2>/dev/null || true
+    [[ -n "${dbus_pid:-}" ]] && kill "${dbus_pid}" 2>/dev/null || true
+    rm -rf "${workdir}"
+}
+trap cleanup EXIT
+
+cat > "${workdir}/bus.conf" <<CONF
+<!DOCTYPE busconfig PUBLIC "-//freedesktop//DTD D-Bus Bus Configuration 1.0//EN"
+ "http://www.freedesktop.org/standards/dbus/1.0/busconfig.dtd">
+<busconfig>
+  <type>custom</type>
+  <listen>unix:path=${workdir}/bus.sock</listen>
+  <auth>EXTERNAL</auth>
+  <limit name="max_incoming_bytes">1000000000</limit>
+  <limit name="max_outgoing_bytes">1000000000</limit>
+  <limit name="max_message_size">134217728</limit>
+  <limit name="max_connections_per_user">1024</limit>
+  <limit name="max_match_rules_per_connection">100000</limit>
+  <limit name="max_replies_per_connection">100000</limit>
+  <policy context="default">
+    <allow send_destination="*" eavesdrop="true"/>
+    <allow eavesdrop="true"/>
+    <allow own="*"/>
+  </policy>
+</busconfig>
+CONF
+
+dbus-daemon --config-file="${workdir}/bus.conf" --nofork --nopidfile &
+dbus_pid=$!
+
+for _ in $(seq 50); do
+    [[ -S "${workdir}/bus.sock" ]] && break
+    sleep 0.1
+done
+
+# sd-bus picks the system or the user bus depending on how it was started,
+# so point both of them at the private daemon.
+export DBUS_SYSTEM_BUS_ADDRESS="unix:path=${workdir}/bus.sock"
+export DBUS_SESSION_BUS_ADDRESS="${DBUS_SYSTEM_BUS_ADDRESS}"
+export DBUS_STARTER_BUS_TYPE=system
+
+"${telemetry}" &
+telemetry_pid=$!
+
+"${loadgen}" "$@"
@@ -0,0 +1,156 @@
+#include "sensor_farm.hpp"
+
+#include <xyz/openbmc_project/Sensor/Value/common.hpp>
+
+#include <charconv>
+
+namespace loadgen
+{
+
+using SensorValue = sdbusplus::common::xyz::openbmc_project::sensor::Value;
+
+namespace
+{
+
+constexpr std::string_view metadataPrefix = "loadgen_";
+constexpr auto maxTickPeriod = std::chrono::milliseconds(10);
+
+} // namespace
+
+SensorFarm::SensorFarm(
+    boost::asio::io_context& ioc,
+    const std::shared_ptr<sdbusplus::asio::object_server>& objServer,
+    const Config& config, LatencyTracker& tracker) :
+    objServer(objServer), tracker(tracker),
+    pattern(makeUpdatePattern(config)),
+    period(std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / config.rate))),
+    tickPeriod(std::min<Clock::duration>(period, maxTickPeriod)), timer(ioc)
+{
+    entries.reserve(config.sensors);
+    for (size_t i = 0; i < config.sensors; ++i)
+    {
+        auto& entry = entries.emplace_back(Entry{nullptr, 50.0, {}});
+        entry.iface = objServer->add_interface(path(i), SensorValue::interface);
+        entry.iface->register_property_r(
+            SensorValue::property_names::value, double{},
+            sdbusplus::vtable::property_::emits_change,
+            [this, i](const auto&) { return entries[i].value; });
+        entry.iface->initialize();
+    }
+}
+
+SensorFarm::~SensorFarm()
+{
+    for (auto& entry : entries)
+    {
+        objServer->remove_interface(entry.iface);
+    }
+}
+
+std::string SensorFarm::path(size_t index)
+{
+    return std::string(SensorValue::namespace_path::value) +
+           "/temperature/loadgen_" + std::to_string(index);
+}
+
+std::string SensorFarm::metadata(size_t index)
+{
+    return std::string(metadataPrefix) + std::to_string(index);
+}
+
+std::optional<size_t> SensorFarm::indexFromMetadata(std::string_view metadata)
+{
+    if (!metadata.starts_with(metadataPrefix))
+    {
+        return std::nullopt;
+    }
+    metadata.remove_prefix(metadataPrefix.size());
+
+    size_t index = 0;
+    const auto [ptr, ec] = std::from_chars(
+        metadata.data(), metadata.data() + metadata.size(), index);
+    if (ec != std::errc() || ptr != metadata.data() + metadata.size())
+    {
+        return std::nullopt;
+    }
+    return index;
+}
+
+std::vector<std::string> SensorFarm::paths() const
+{
+    std::vector<std::string> result;
+    result.reserve(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        result.emplace_back(path(i));
+    }
+    return result;
+}
+
+void SensorFarm::start()
+{
+    // Spread sensors evenly over one period so updates do not all land in
+    // the same tick.
+    const auto now = Clock::now();
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        entries[i].nextDue =
+            now + period * static_cast<int64_t>(i) /
+                      static_cast<int64_t>(entries.size());
+    }
+
+    running = true;
+    scheduleTick();
+}
+
+void SensorFarm::stop()
+{
+    running = false;
+    timer.cancel();
+}
+
+void SensorFarm::scheduleTick()
+{
+    timer.expires_after(tickPeriod);
+    timer.async_wait([this](boost::system::error_code ec) {
+        if (ec || !running)
+        {
+            return;
+        }
+        tick();
+        scheduleTick();
+    });
+}
+
+void SensorFarm::tick()
+{
+    const auto now = Clock::now();
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        auto& entry = entries[i];
+        if (entry.nextDue > now)
+        {
+            continue;
+        }
+
+        do
+        {
+            entry.nextDue += period;
+        } while (entry.nextDue <= now);
+
+        pendingValues.clear();
+        pattern->next(entry.value, pendingValues);
+
+        for (const double value : pendingValues)
+        {
+            entry.value = value;
+            tracker.sent(i, value, Clock::now());
+            entry.iface->signal_property(SensorValue::property_names::value);
+            ++published;
+        }
+    }
+}
+
+} // namespace loadgen
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "config.hpp"
+#include "latency_tracker.hpp"
+#include "update_pattern.hpp"
+
+#include <boost/asio/steady_timer.hpp>
+#include <sdbusplus/asio/object_server.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace loadgen
+{
+
+/** Hosts fake xyz.openbmc_project.Sensor.Value objects and publishes
+ *  PropertiesChanged signals for them according to the update pattern. */
+class SensorFarm
+{
+  public:
+    SensorFarm(boost::asio::io_context& ioc,
+               const std::shared_ptr<sdbusplus::asio::object_server>& objServer,
+               const Config& config, LatencyTracker& tracker);
+    ~SensorFarm();
+
+    SensorFarm(const SensorFarm&) = delete;
+    SensorFarm& operator=(const SensorFarm&) = delete;
+
+    static std::string path(size_t index);
+    static std::string metadata(size_t index);
+    static std::optional<size_t> indexFromMetadata(std::string_view metadata);
+
+    std::vector<std::string> paths() const;
+
+    void start();
+    void stop();
+
+    uint64_t publishedUpdates() const
+    {
+        return published;
+    }
+
+  private:
+    using Clock = LatencyTracker::Clock;
+
+    struct Entry
+    {
+        std::shared_ptr<sdbusplus::asio::dbus_interface> iface;
+        double value;
+        Clock::time_point nextDue;
+    };
+
+    void scheduleTick();
+    void tick();
+
+    std::shared_ptr<sdbusplus::asio::object_server> objServer;
+    LatencyTracker& tracker;
+    std::unique_ptr<UpdatePattern> pattern;
+    Clock::duration period;
+    Clock::duration tickPeriod;
+    boost::asio::steady_timer timer;
+    std::vector<Entry> entries;
+    std::vector<double> pendingValues;
+    uint64_t published = 0;
+    bool running = false;
+};
+
+} // namespace loadgen
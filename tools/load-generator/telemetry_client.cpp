@@ -0,0 +1,233 @@
+#include "telemetry_client.hpp"
+
+#include "sensor_farm.hpp"
+#include "types/collection_time_scope.hpp"
+#include "types/operation_type.hpp"
+#include "types/readings.hpp"
+#include "types/report_action.hpp"
+#include "types/report_types.hpp"
+#include "types/report_updates.hpp"
+#include "types/reporting_type.hpp"
+#include "types/trigger_types.hpp"
+
+#include <boost/asio/steady_timer.hpp>
+#include <boost/container/flat_map.hpp>
+#include <xyz/openbmc_project/Object/Delete/common.hpp>
+#include <xyz/openbmc_project/Telemetry/Report/common.hpp>
+#include <xyz/openbmc_project/Telemetry/ReportManager/common.hpp>
+#include <xyz/openbmc_project/Telemetry/TriggerManager/common.hpp>
+
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace loadgen
+{
+
+using ObjectDelete = sdbusplus::common::xyz::openbmc_project::object::Delete;
+using TelemetryReport =
+    sdbusplus::common::xyz::openbmc_project::telemetry::Report;
+using TelemetryReportManager =
+    sdbusplus::common::xyz::openbmc_project::telemetry::ReportManager;
+using TelemetryTriggerManager =
+    sdbusplus::common::xyz::openbmc_project::telemetry::TriggerManager;
+
+namespace
+{
+
+constexpr const char* telemetryService = "xyz.openbmc_project.Telemetry";
+constexpr const char* triggerManagerPath =
+    "/xyz/openbmc_project/Telemetry/Triggers";
+constexpr const char* dbusService = "org.freedesktop.DBus";
+constexpr const char* dbusPath = "/org/freedesktop/DBus";
+constexpr const char* dbusInterface = "org.freedesktop.DBus";
+constexpr double triggerThreshold = 50.0;
+
+} // namespace
+
+TelemetryClient::TelemetryClient(
+    const std::shared_ptr<sdbusplus::asio::connection>& bus,
+    const Config& config, LatencyTracker& tracker) :
+    bus(bus), config(config), tracker(tracker)
+{
+    using namespace std::string_literals;
+
+    readingsMatch = std::make_unique<sdbusplus::bus::match_t>(
+        *bus,
+        "type='signal',member='PropertiesChanged',"
+        "interface='org.freedesktop.DBus.Properties',path_namespace='"s +
+            TelemetryReport::namespace_path + "',arg0='" +
+            TelemetryReport::interface + "'",
+        [this](sdbusplus::message_t& message) { readingsChanged(message); });
+}
+
+void TelemetryClient::waitForService(boost::asio::yield_context yield)
+{
+    boost::asio::steady_timer timer(bus->get_io_context());
+
+    while (true)
+    {
+        boost::system::error_code ec;
+        const bool hasOwner = bus->yield_method_call<bool>(
+            yield, ec, dbusService, dbusPath, dbusInterface, "NameHasOwner",
+            std::string(telemetryService));
+        if (!ec && hasOwner)
+        {
+            return;
+        }
+
+        timer.expires_after(std::chrono::milliseconds(100));
+        timer.async_wait(yield);
+    }
+}
+
+pid_t TelemetryClient::servicePid(boost::asio::yield_context yield)
+{
+    boost::system::error_code ec;
+    const auto pid = bus->yield_method_call<uint32_t>(
+        yield, ec, dbusService, dbusPath, dbusInterface,
+        "GetConnectionUnixProcessID", std::string(telemetryService));
+    if (ec)
+    {
+        throw std::runtime_error("Failed to get pid of telemetry service");
+    }
+    return static_cast<pid_t>(pid);
+}
+
+void TelemetryClient::addReports(boost::asio::yield_context yield)
+{
+    const auto reportingType = config.reportingType == "Periodic"
+                                   ? ReportingType::periodic
+                                   : ReportingType::onChange;
+
+    for (size_t r = 0; r < config.reports; ++r)
+    {
+        ReadingParameters readingParameters;
+        for (size_t m = 0; m < config.metricsPerReport; ++m)
+        {
+            const auto sensor = (r * config.metricsPerReport + m) %
+                                config.sensors;
+            tracker.track(sensor);
+            readingParameters.emplace_back(
+                std::vector<std::tuple<sdbusplus::object_path, std::string>>{
+                    {sdbusplus::object_path(SensorFarm::path(sensor)),
+                     SensorFarm::metadata(sensor)}},
+                utils::enumToString(OperationType::max),
+                utils::enumToString(CollectionTimeScope::point), 0u);
+        }
+
+        const auto id = "LoadGen/Report" + std::to_string(r);
+
+        boost::system::error_code ec;
+        auto path = bus->yield_method_call<sdbusplus::object_path>(
+            yield, ec, telemetryService, TelemetryReport::namespace_path,
+            TelemetryReportManager::interface,
+            TelemetryReportManager::method_names::add_report, id, id,
+            utils::enumToString(reportingType),
+            utils::enumToString(ReportUpdates::overwrite),
+            std::numeric_limits<uint64_t>::max(),
+            std::vector<std::string>{
+                utils::enumToString(ReportAction::emitsReadingsUpdate)},
+            reportingType == ReportingType::periodic ? config.interval
+                                                     : uint64_t{0},
+            readingParameters, true);
+        if (ec)
+        {
+            throw std::runtime_error("AddReport failed for " + id + ": " +
+                                     ec.message());
+        }
+        reports.emplace_back(std::move(path));
+    }
+}
+
+void TelemetryClient::addTriggers(boost::asio::yield_context yield)
+{
+    for (size_t t = 0; t < config.triggers; ++t)
+    {
+        SensorsInfo sensors;
+        for (size_t s = 0; s < config.sensorsPerTrigger; ++s)
+        {
+            const auto sensor = (t * config.sensorsPerTrigger + s) %
+                                config.sensors;
+            sensors.emplace_back(
+                sdbusplus::object_path(SensorFarm::path(sensor)),
+                SensorFarm::metadata(sensor));
+        }
+
+        const std::vector<numeric::ThresholdParam> numericThresholds = {
+            {numeric::typeToString(numeric::Type::upperWarning), 0u,
+             numeric::directionToString(numeric::Direction::either),
+             triggerThreshold}};
+
+        const auto id = "LoadGen/Trigger" + std::to_string(t);
+
+        boost::system::error_code ec;
+        auto path = bus->yield_method_call<sdbusplus::object_path>(
+            yield, ec, telemetryService, triggerManagerPath,
+            TelemetryTriggerManager::interface,
+            TelemetryTriggerManager::method_names::add_trigger, id, id,
+            std::vector<std::string>{}, sensors,
+            std::vector<sdbusplus::object_path>{}, numericThresholds,
+            std::vector<discrete::ThresholdParam>{});
+        if (ec)
+        {
+            throw std::runtime_error("AddTrigger failed for " + id + ": " +
+                                     ec.message());
+        }
+        triggers.emplace_back(std::move(path));
+    }
+}
+
+void TelemetryClient::removeAll(boost::asio::yield_context yield)
+{
+    for (const auto& paths : {std::ref(triggers), std::ref(reports)})
+    {
+        for (const auto& path : paths.get())
+        {
+            boost::system::error_code ec;
+            bus->yield_method_call<>(yield, ec, telemetryService, path.str,
+                                     ObjectDelete::interface,
+                                     ObjectDelete::method_names::delete_);
+            if (ec)
+            {
+                std::cerr << "Failed to delete " << path.str << ": "
+                          << ec.message() << "\n";
+            }
+        }
+        paths.get().clear();
+    }
+}
+
+void TelemetryClient::readingsChanged(sdbusplus::message_t& message)
+{
+    const auto timestamp = LatencyTracker::Clock::now();
+
+    std::string iface;
+    boost::container::flat_map<std::string,
+                               std::variant<std::monostate, Readings>>
+        changedProperties;
+    message.read(iface, changedProperties);
+
+    auto it = changedProperties.find(TelemetryReport::property_names::readings);
+    if (it == changedProperties.end())
+    {
+        return;
+    }
+
+    const auto* readings = std::get_if<Readings>(&it->second);
+    if (!readings)
+    {
+        return;
+    }
+
+    ++readingsSignals;
+    for (const auto& [metadata, value, _] : std::get<1>(*readings))
+    {
+        if (auto index = SensorFarm::indexFromMetadata(metadata))
+        {
+            tracker.observed(*index, value, timestamp);
+        }
+    }
+}
+
+} // namespace loadgen
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "config.hpp"
+#include "latency_tracker.hpp"
+
+#include <boost/asio/spawn.hpp>
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/bus/match.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace loadgen
+{
+
+/** Drives the telemetry service through its public D-Bus API. */
+class TelemetryClient
+{
+  public:
+    TelemetryClient(const std::shared_ptr<sdbusplus::asio::connection>& bus,
+                    const Config& config, LatencyTracker& tracker);
+
+    void waitForService(boost::asio::yield_context yield);
+    pid_t servicePid(boost::asio::yield_context yield);
+    void addReports(boost::asio::yield_context yield);
+    void addTriggers(boost::asio::yield_context yield);
+    void removeAll(boost::asio::yield_context yield);
+
+    uint64_t receivedReadingsSignals() const
+    {
+        return readingsSignals;
+    }
+
+  private:
+    void readingsChanged(sdbusplus::message_t& message);
+
+    std::shared_ptr<sdbusplus::asio::connection> bus;
+    const Config& config;
+    LatencyTracker& tracker;
+    std::unique_ptr<sdbusplus::bus::match_t> readingsMatch;
+    std::vector<sdbusplus::object_path> reports;
+    std::vector<sdbusplus::object_path> triggers;
+    uint64_t readingsSignals = 0;
+};
+
+} // namespace loadgen
@@ -0,0 +1,81 @@
+#include "update_pattern.hpp"
+
+namespace loadgen
+{
+
+namespace
+{
+
+constexpr double lowValue = 20.0;
+constexpr double highValue = 80.0;
+
+class RandomWalk : public UpdatePattern
+{
+  public:
+    void next(double current, std::vector<double>& out) override
+    {
+        out.push_back(step(current));
+    }
+
+  protected:
+    double step(double current)
+    {
+        double delta = distribution(generator);
+        if (delta == 0.0)
+        {
+            delta = 0.5;
+        }
+
+        const double value = current + delta;
+        return (value < 0.0 || value > 100.0) ? current - delta : value;
+    }
+
+  private:
+    std::mt19937 generator{std::random_device{}()};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+};
+
+class SquareWave : public UpdatePattern
+{
+  public:
+    void next(double current, std::vector<double>& out) override
+    {
+        out.push_back(current < highValue ? highValue : lowValue);
+    }
+};
+
+class Burst : public RandomWalk
+{
+  public:
+    explicit Burst(size_t burstSize) : burstSize(burstSize) {}
+
+    void next(double current, std::vector<double>& out) override
+    {
+        for (size_t i = 0; i < burstSize; ++i)
+        {
+            current = step(current);
+            out.push_back(current);
+        }
+    }
+
+  private:
+    size_t burstSize;
+};
+
+} // namespace
+
+std::unique_ptr<UpdatePattern> makeUpdatePattern(const Config& config)
+{
+    switch (config.pattern)
+    {
+        case Pattern::squareWave:
+            return std::make_unique<SquareWave>();
+        case Pattern::burst:
+            return std::make_unique<Burst>(config.burstSize);
+        case Pattern::randomWalk:
+            break;
+    }
+    return std::make_unique<RandomWalk>();
+}
+
+} // namespace loadgen
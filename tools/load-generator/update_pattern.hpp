@@ -0,0 +1,23 @@
+#pragma once
+
+#include "config.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace loadgen
+{
+
+/** Produces the values published by a sensor each time it is due. */
+class UpdatePattern
+{
+  public:
+    virtual ~UpdatePattern() = default;
+
+    virtual void next(double current, std::vector<double>& out) = 0;
+};
+
+std::unique_ptr<UpdatePattern> makeUpdatePattern(const Config& config);
+
+} // namespace loadgen